@@ -14,6 +14,7 @@ message(STATUS "")
 
 OPTION(WITH_C11 "With C++ compiler C11 features." OFF)
 OPTION(WITH_OPENMP "With OpenMP (compiler multithread programming) features." OFF)
+OPTION(WITH_BOOST_THREAD "With Boost.Thread multithread features (when OpenMP is not used)." OFF)
 OPTION(WITH_GMP "With Gnu Multiprecision Library (GMP)." OFF)
 OPTION(WITH_EIGEN "With Eigen3 Linear Algebra Library." OFF)
 OPTION(WITH_CGAL "With CGAL." OFF)
@@ -59,6 +60,13 @@ ELSE(WITH_OPENMP)
 message(STATUS "      WITH_OPENMP       false   (OpenMP multithread features)")
 ENDIF(WITH_OPENMP)
 
+IF(WITH_BOOST_THREAD)
+SET (LIST_OPTION ${LIST_OPTION} [BoostThread]\ )
+message(STATUS "      WITH_BOOST_THREAD true    (Boost.Thread multithread features)")
+ELSE(WITH_BOOST_THREAD)
+message(STATUS "      WITH_BOOST_THREAD false   (Boost.Thread multithread features)")
+ENDIF(WITH_BOOST_THREAD)
+
 IF(WITH_GMP)
 SET (LIST_OPTION ${LIST_OPTION} [GMP]\ )
 message(STATUS "      WITH_GMP          true    (Gnu Multiprecision Library)")
@@ -310,12 +318,21 @@ SET(HDF5_FOUND_DGTAL 0)
 IF(WITH_HDF5)
   FIND_PACKAGE (HDF5 REQUIRED HL C)
   IF(HDF5_FOUND)
+    # H5Dread_chunk and H5Dwrite_chunk (HDF5ChunkedIO) need HDF5 >= 1.10.3.
+    IF(HDF5_VERSION AND HDF5_VERSION VERSION_LESS "1.10.3")
+      message(FATAL_ERROR "HDF5 ${HDF5_VERSION} found, HDF5 >= 1.10.3 is required. Update HDF5 or disable it." )
+    ENDIF(HDF5_VERSION AND HDF5_VERSION VERSION_LESS "1.10.3")
     INCLUDE_DIRECTORIES(${HDF5_INCLUDE_DIRS})
     SET(DGtalLibDependencies ${DGtalLibDependencies} ${HDF5_LIBRARIES})
     message(STATUS "HDF5 found")
     SET(HDF5_FOUND_DGTAL 1)
     SET(DGtalLibInc ${DGtalLibInc} ${HDF5_INCLUDE_DIRS})
     ADD_DEFINITIONS("-DWITH_HDF5 ")
+    # ZLIB is used to (de)compress the HDF5 chunks in parallel.
+    FIND_PACKAGE (ZLIB REQUIRED)
+    INCLUDE_DIRECTORIES(${ZLIB_INCLUDE_DIRS})
+    SET(DGtalLibDependencies ${DGtalLibDependencies} ${ZLIB_LIBRARIES})
+    SET(DGtalLibInc ${DGtalLibInc} ${ZLIB_INCLUDE_DIRS})
   ELSE(HDF5_FOUND)
     message(FATAL_ERROR "HDF5 not found. Check the cmake variables associated to this package or disable it." )
   ENDIF(HDF5_FOUND)
@@ -398,6 +415,23 @@ IF(WITH_OPENMP)
   ENDIF(OPENMP_FOUND)
 ENDIF(WITH_OPENMP)
 
+# -----------------------------------------------------------------------------
+# Look for Boost.Thread
+# (They are not compulsory).
+# -----------------------------------------------------------------------------
+SET(BOOST_THREAD_FOUND_DGTAL 0)
+IF(WITH_BOOST_THREAD)
+  FIND_PACKAGE(Boost 1.46.0 COMPONENTS thread system)
+  IF(Boost_THREAD_FOUND AND Boost_SYSTEM_FOUND)
+    SET(BOOST_THREAD_FOUND_DGTAL 1)
+    SET(DGtalLibDependencies ${DGtalLibDependencies} ${Boost_THREAD_LIBRARY} ${Boost_SYSTEM_LIBRARY})
+    ADD_DEFINITIONS("-DWITH_BOOST_THREAD ")
+    message(STATUS "Boost.Thread found.")
+  ELSE(Boost_THREAD_FOUND AND Boost_SYSTEM_FOUND)
+    message(FATAL_ERROR "Boost.Thread not found. Check the cmake variables associated to this package or disable it.")
+  ENDIF(Boost_THREAD_FOUND AND Boost_SYSTEM_FOUND)
+ENDIF(WITH_BOOST_THREAD)
+
 # -----------------------------------------------------------------------------
 # Look for Eigen3
 # (They are not compulsory).
@@ -45,6 +45,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <iterator>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/SimpleMatrix.h"
@@ -59,6 +61,57 @@
 namespace DGtal
 {
 
+namespace details
+{
+  /**
+  * Identity functor on convolution results, used to evaluate ranges
+  * without functor by chunks.
+  *
+  * @tparam TValue type of the convolution result (Quantity or CovarianceMatrix).
+  */
+  template< typename TValue >
+  struct ConvolverIdentity
+  {
+    typedef TValue Value;
+
+    const Value & operator() ( const Value & aValue ) const
+    {
+      return aValue;
+    }
+  };
+
+  /**
+  * Evaluates a range of surfels by chunks of consecutive surfels, in
+  * parallel with OpenMP. Each chunk is evaluated by a sequential range
+  * method of a DigitalSurfaceConvolver (eval or evalCovarianceMatrix),
+  * then results are output in the order of the range.
+  *
+  * @param[in] aConvolver the convolver.
+  * @param[in] aMethod the sequential range method of the convolver, with an output in a vector.
+  * @param[in] aChunkSize the number of surfels per chunk.
+  * @param[in] itbegin (iterator of the) first surfel of the range.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the range.
+  * @param[out] result iterator where the results are set.
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam TConvolver type of DigitalSurfaceConvolver.
+  * @tparam TSurfelIterator type of iterator of a surfel on the shape.
+  * @tparam TOutputIterator type of iterator on an array where results are stored.
+  * @tparam TEvalFunctor type of functor on the convolution result.
+  */
+  template< typename TConvolver, typename TSurfelIterator, typename TOutputIterator, typename TEvalFunctor >
+  void convolveByChunks ( const TConvolver & aConvolver,
+                          void ( TConvolver::*aMethod ) ( const typename std::vector< typename TConvolver::Spel >::const_iterator &,
+                                                          const typename std::vector< typename TConvolver::Spel >::const_iterator &,
+                                                          std::back_insert_iterator< std::vector< typename TEvalFunctor::Value > > &,
+                                                          TEvalFunctor ) const,
+                          const unsigned int aChunkSize,
+                          const TSurfelIterator & itbegin,
+                          const TSurfelIterator & itend,
+                          TOutputIterator & result,
+                          const TEvalFunctor & functor );
+} // namespace details
+
 /////////////////////////////////////////////////////////////////////////////
 // template class DigitalSurfaceConvolver
 /**
@@ -291,6 +344,26 @@ public:
   */
   bool isValid () const;
 
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * the range versions of eval() and evalCovarianceMatrix(), when DGtal
+  * is built with OpenMP. The range is split into consecutive chunks,
+  * each one evaluated with the masks optimization from a full kernel
+  * evaluation on its first surfel: as for the sequential evaluation,
+  * surfels should be given in a spatially coherent order (a surface
+  * traversal for instance). Results are the same as the ones of the
+  * sequential evaluation.
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel (0 if ranges are evaluated sequentially).
+  */
+  unsigned int chunkSize () const;
+
 protected:
 
   /**
@@ -400,6 +473,8 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  unsigned int myChunkSize; ///< Number of surfels of the chunks evaluated in parallel, 0 for a sequential evaluation.
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
@@ -430,6 +505,13 @@ private:
 
 private:
 
+  /**
+  * @return 'true' if ranges must be evaluated by chunks in parallel:
+  * OpenMP is enabled with several threads, chunkSize() is not 0, and
+  * we are not already in a parallel region.
+  */
+  bool useChunks () const;
+
 }; // end of class DigitalSurfaceConvolver
 
 template< typename TFunctor, typename TKernelFunctor, typename TKSpace, typename TDigitalKernel >
@@ -653,6 +735,26 @@ public:
   */
   bool isValid () const;
 
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * the range versions of eval() and evalCovarianceMatrix(), when DGtal
+  * is built with OpenMP. The range is split into consecutive chunks,
+  * each one evaluated with the masks optimization from a full kernel
+  * evaluation on its first surfel: as for the sequential evaluation,
+  * surfels should be given in a spatially coherent order (a surface
+  * traversal for instance). Results are the same as the ones of the
+  * sequential evaluation.
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel (0 if ranges are evaluated sequentially).
+  */
+  unsigned int chunkSize () const;
+
 protected:
 
   /**
@@ -764,6 +866,8 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  unsigned int myChunkSize; ///< Number of surfels of the chunks evaluated in parallel, 0 for a sequential evaluation.
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
@@ -794,6 +898,13 @@ private:
 
 private:
 
+  /**
+  * @return 'true' if ranges must be evaluated by chunks in parallel:
+  * OpenMP is enabled with several threads, chunkSize() is not 0, and
+  * we are not already in a parallel region.
+  */
+  bool useChunks () const;
+
 }; // end of class DigitalSurfaceConvolver
 
 template< typename TFunctor, typename TKernelFunctor, typename TKSpace, typename TDigitalKernel >
@@ -1019,6 +1130,26 @@ public:
    */
   bool isValid() const;
 
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * the range versions of eval() and evalCovarianceMatrix(), when DGtal
+  * is built with OpenMP. The range is split into consecutive chunks,
+  * each one evaluated with the masks optimization from a full kernel
+  * evaluation on its first surfel: as for the sequential evaluation,
+  * surfels should be given in a spatially coherent order (a surface
+  * traversal for instance). Results are the same as the ones of the
+  * sequential evaluation.
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel (0 if ranges are evaluated sequentially).
+  */
+  unsigned int chunkSize () const;
+
 protected:
 
   /**
@@ -1131,6 +1262,8 @@ private:
 
   Spel myKernelSpelOrigin; ///< Copy of the origin cell of the kernel.
 
+  unsigned int myChunkSize; ///< Number of surfels of the chunks evaluated in parallel, 0 for a sequential evaluation.
+
   // ------------------------- Hidden services ------------------------------
 
 protected:
@@ -1161,6 +1294,13 @@ private:
 
 private:
 
+  /**
+  * @return 'true' if ranges must be evaluated by chunks in parallel:
+  * OpenMP is enabled with several threads, chunkSize() is not 0, and
+  * we are not already in a parallel region.
+  */
+  bool useChunks () const;
+
 }; // end of class DigitalSurfaceConvolver
 
 
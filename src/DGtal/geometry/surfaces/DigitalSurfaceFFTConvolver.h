@@ -0,0 +1,383 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceFFTConvolver.h
+ * @brief Compute the convolution between a nD-shape and a convolution kernel on the whole bounding box of a range of surfels with FFT, and sample it at the surfels.
+ *
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see DigitalSurfaceConvolver.h IntegralInvariantMeanCurvatureEstimator.h IntegralInvariantGaussianCurvatureEstimator.h
+ */
+
+#if defined(DigitalSurfaceFFTConvolver_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceFFTConvolver.h
+#else // defined(DigitalSurfaceFFTConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceFFTConvolver_RECURSES
+
+#if !defined DigitalSurfaceFFTConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceFFTConvolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/SimpleMatrix.h"
+#include "DGtal/kernel/CCellFunctor.h"
+#include "DGtal/math/MixedRadixFFT.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class DigitalSurfaceFFTConvolver
+/**
+   * Description of class 'DigitalSurfaceFFTConvolver' <p>
+   *
+   * Aim: Compute the same convolutions as DigitalSurfaceConvolver
+   * (volume of the intersection of the shape with the kernel, and
+   * covariance matrix of this intersection, at the inner and outer
+   * spels of each surfel) on a whole range of surfels at once, with
+   * Fast Fourier Transforms (see MixedRadixFFT).
+   *
+   * The indicator function of the shape is sampled on the bounding box
+   * of the spels of the range, dilated by the kernel. The volume field
+   * and the fields of the moments of order 1 and 2 of the kernel are
+   * obtained on the whole box by FFT based convolutions (two moment
+   * kernels per complex transform), and then sampled at the spels. The
+   * cost depends on the size of the box, \f$ O(N \log N) \f$, instead
+   * of the size of the kernel for each surfel: this backend is
+   * interesting for large kernels (radius of more than about twenty
+   * grid steps) and dense ranges of surfels.
+   *
+   * The moments are computed relatively to each spel and rounded to
+   * the nearest integer, so that they are exact. Volumes are then
+   * identical to the ones of DigitalSurfaceConvolver, while
+   * covariance matrices only differ by floating-point rounding.
+   *
+   * Only range evaluations are available.
+   *
+   * The convolver may also be initialized with several nested kernels
+   * (e.g. balls of increasing radii, for multi-scale estimations): the
+   * shape is then sampled and transformed once for all the kernels,
+   * on the box of the largest one, and the fields of all the kernels
+   * are sampled in the same sweep (see evalAllKernels and
+   * evalCovarianceMatrixAllKernels).
+   *
+   * @tparam TFunctor a model of a functor for the shape to convolve ( f(x) ).
+   * @tparam TKSpace space in which the shape is defined.
+   * @tparam TDigitalKernel type of a convolution kernel (digitization of an ImplicitBall in general case), with methods getDomain() and operator()( Point ).
+   */
+template< typename TFunctor, typename TKSpace, typename TDigitalKernel >
+class DigitalSurfaceFFTConvolver
+{
+  // ----------------------- Types ------------------------------------------
+
+public:
+
+  typedef TFunctor Functor;
+  typedef TKSpace KSpace;
+  typedef TDigitalKernel DigitalKernel;
+
+  static const Dimension dimension = KSpace::dimension;
+
+  typedef double Quantity;
+  typedef SimpleMatrix< double, dimension, dimension > CovarianceMatrix;
+
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Point Point;
+  typedef MixedRadixFFT::Complex Complex;
+
+  BOOST_CONCEPT_ASSERT (( CCellFunctor< Functor > ));
+
+  // ----------------------- Standard services ------------------------------
+
+public:
+
+  /**
+  * Constructor.
+  *
+  * @param[in] f a functor f(x).
+  * @param[in] space space in which the shape is defined.
+  */
+  DigitalSurfaceFFTConvolver ( ConstAlias< Functor > f,
+                               ConstAlias< KSpace > space );
+
+  /**
+  * Destructor.
+  */
+  ~DigitalSurfaceFFTConvolver() {}
+
+  // ----------------------- Interface --------------------------------------
+
+public:
+
+  /**
+  * Initialize the convolver with the full kernel.
+  *
+  * @param[in] pOrigin center (digital point) of the kernel support.
+  * @param[in] fullKernel the digital kernel (its points are read once).
+  */
+  void init ( const Point & pOrigin,
+              ConstAlias< DigitalKernel > fullKernel );
+
+  /**
+  * Initialize the convolver with nested kernels: each kernel must be
+  * included in the next one. Single kernel evaluations (eval and
+  * evalCovarianceMatrix) then use the last (largest) kernel.
+  *
+  * @param[in] pOrigin center (digital point) of the kernel supports.
+  * @param[in] nestedKernels the digital kernels, by increasing size (their points are read once).
+  */
+  void init ( const Point & pOrigin,
+              const std::vector< const DigitalKernel * > & nestedKernels );
+
+  /**
+  * @return the number of (nested) kernels of the convolver.
+  */
+  unsigned int nbKernels () const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result ) const;
+
+  /**
+  * Convolve the kernel at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  * @param[in] functor functor called with the result of the convolution.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  * @tparam EvalFunctor type of functor on Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void eval ( const SurfelIterator & itbegin,
+              const SurfelIterator & itend,
+              OutputIterator & result,
+              EvalFunctor functor ) const;
+
+  /**
+  * Compute the covariance matrix at all positions of the range [itBegin, itEnd[ and outputs results sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where estimates covariance matrix are set ( the covariance matrix from *itbegin till *itend (excluded)).
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when CovarianceMatrix are stored.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result ) const;
+
+  /**
+  * Compute the covariance matrix at all positions of the range [itBegin, itEnd[ and applies the functor \a functor on results outputed sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array where estimates quantities are set ( the estimated quantity from *itbegin till *itend (excluded)).
+  * @param[in] functor functor called with the result of the computation.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when Quantity are stored.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrix ( const SurfelIterator & itbegin,
+                              const SurfelIterator & itend,
+                              OutputIterator & result,
+                              EvalFunctor functor ) const;
+
+  /**
+  * Convolve each of the nested kernels at all positions of the range [itBegin, itEnd[ and outputs, for each surfel, the vector of the results of the functors (one per kernel) sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the convolution is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the convolution is computed.
+  * @param[out] result iterator of an array of std::vector< EvalFunctor::Value > ( the estimated quantities from *itbegin till *itend (excluded)).
+  * @param[in] functors functors called with the results of the convolutions, one per kernel.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when vectors of EvalFunctor::Value are stored.
+  * @tparam EvalFunctor type of functor on Quantity.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalAllKernels ( const SurfelIterator & itbegin,
+                        const SurfelIterator & itend,
+                        OutputIterator & result,
+                        std::vector< EvalFunctor > functors ) const;
+
+  /**
+  * Compute the covariance matrix of each of the nested kernels at all positions of the range [itBegin, itEnd[ and outputs, for each surfel, the vector of the results of the functors (one per kernel) sequentially with \a result iterator.
+  *
+  * @param[in] itbegin (iterator of the) first surfel of the shape where the covariance matrix is computed.
+  * @param[in] itend (iterator of the) last (excluded) surfel of the shape where the covariance matrix is computed.
+  * @param[out] result iterator of an array of std::vector< EvalFunctor::Value > ( the estimated quantities from *itbegin till *itend (excluded)).
+  * @param[in] functors functors called with the covariance matrices, one per kernel.
+  *
+  * @tparam SurfelIterator type of iterator of a surfel on the shape.
+  * @tparam OutputIterator type of iterator on an array when vectors of EvalFunctor::Value are stored.
+  * @tparam EvalFunctor type of functor on CovarianceMatrix.
+  */
+  template< typename SurfelIterator, typename OutputIterator, typename EvalFunctor >
+  void evalCovarianceMatrixAllKernels ( const SurfelIterator & itbegin,
+                                        const SurfelIterator & itend,
+                                        OutputIterator & result,
+                                        std::vector< EvalFunctor > functors ) const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+
+private:
+
+  /// Number of moments (order 0, 1 and 2) of the kernel
+  static const unsigned int nbMoments = 1 + dimension + ( dimension * ( dimension + 1 ) ) / 2;
+
+  const Functor & myFFunctor; ///< Functor of the shape
+  const KSpace & myKSpace; ///< Space in which the shape is defined
+
+  std::vector< Point > myOffsets; ///< Points of the kernels, relatively to their center, sorted by kernel
+  std::vector< std::size_t > myKernelEnds; ///< Kernel k is made of myOffsets[0..myKernelEnds[k]-1]
+  Point myLowerOffset; ///< Lower bound of myOffsets
+  Point myUpperOffset; ///< Upper bound of myOffsets
+
+  bool isInit; ///< True if the kernel is set
+
+  // ------------------------- Internals ------------------------------------
+
+private:
+
+  /**
+  * Gathers the inner and outer spels of a range of surfels.
+  *
+  * @param[in] itbegin (iterator of the) first surfel.
+  * @param[in] itend (iterator of the) last (excluded) surfel.
+  * @param[out] spels coordinates of the inner (even indices) and outer (odd indices) spels of each surfel.
+  */
+  template< typename SurfelIterator >
+  void gatherSpels ( const SurfelIterator & itbegin,
+                     const SurfelIterator & itend,
+                     std::vector< Point > & spels ) const;
+
+  /**
+  * Computes the volume field (and the moment fields) of the kernels
+  * [firstKernel, nbKernels()[ on the bounding box of the spels and
+  * samples them.
+  *
+  * @param[in] spels coordinates of the spels.
+  * @param[in] nbFields 1 (volume only) or nbMoments.
+  * @param[in] firstKernel index of the first kernel.
+  * @param[out] values the @a nbFields values of each kernel, kernel by kernel, spel by spel.
+  */
+  void computeFields ( const std::vector< Point > & spels,
+                       const unsigned int nbFields,
+                       const unsigned int firstKernel,
+                       std::vector< Quantity > & values ) const;
+
+  /**
+  * @param[in] aOffset a point of the kernel (relative to its center).
+  * @param[in] aMoment index of a moment, in [0,nbMoments[ : 1, the coordinates and the products of two coordinates.
+  * @return the weight of @a aOffset for the moment @a aMoment.
+  */
+  Quantity momentWeight ( const Point & aOffset, const unsigned int aMoment ) const;
+
+  /**
+  * Computes the covariance matrix from the moments.
+  *
+  * @param[in] aMomentMatrix the nbMoments moments.
+  * @param[out] aCovarianceMatrix the covariance matrix.
+  */
+  void computeCovarianceMatrix ( const Quantity * aMomentMatrix,
+                                 CovarianceMatrix & aCovarianceMatrix ) const;
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  DigitalSurfaceFFTConvolver ( const DigitalSurfaceFFTConvolver & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  DigitalSurfaceFFTConvolver & operator= ( const DigitalSurfaceFFTConvolver & other );
+
+}; // end of class DigitalSurfaceFFTConvolver
+
+
+/**
+ * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceFFTConvolver'.
+ * @param out the output stream where the object is written.
+ * @param object the object of class 'DigitalSurfaceFFTConvolver' to write.
+ * @return the output stream after the writing.
+ */
+template< typename TF, typename TKS, typename TDK >
+std::ostream&
+operator<< ( std::ostream & out, const DigitalSurfaceFFTConvolver< TF, TKS, TDK > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceFFTConvolver_h
+
+#undef DigitalSurfaceFFTConvolver_RECURSES
+#endif // else defined(DigitalSurfaceFFTConvolver_RECURSES)
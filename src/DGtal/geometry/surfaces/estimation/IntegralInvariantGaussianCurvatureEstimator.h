@@ -55,6 +55,7 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -432,6 +433,21 @@ public:
                                  const SurfelIterator & ite,
                                  OutputIterator & result );
 
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * eval() on a range of surfels with the incremental convolution, when
+  * DGtal is built with OpenMP (see DigitalSurfaceConvolver::setChunkSize).
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel.
+  */
+  unsigned int chunkSize () const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -510,6 +526,7 @@ public:
   typedef GaussDigitizer< Z2i::Space, EuclideanMinus > DigitalShape;
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, KSpace, DigitalShapeKernel> Convolver;
+  typedef DigitalSurfaceFFTConvolver<ShapeSpelFunctor, KSpace, DigitalShapeKernel> FFTConvolver;
 
   typedef typename Convolver::CovarianceMatrix Matrix2x2;
 
@@ -622,6 +639,37 @@ public:
                                  const SurfelIterator & ite,
                                  OutputIterator & result );
 
+  /**
+  * Chooses how ranges of surfels are evaluated: either with the
+  * incremental convolution on masks (default), or with the FFT based
+  * convolution on the bounding box of the surfels (see
+  * DigitalSurfaceFFTConvolver), which is faster for large kernels.
+  * Single surfel evaluations always use the incremental convolution.
+  *
+  * @param[in] aFlag true to evaluate ranges with FFT.
+  */
+  void setFFTConvolution ( const bool aFlag );
+
+  /**
+  * @return true if ranges of surfels are evaluated with FFT.
+  */
+  bool fftConvolution () const;
+
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * eval() on a range of surfels with the incremental convolution, when
+  * DGtal is built with OpenMP (see DigitalSurfaceConvolver::setChunkSize).
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel.
+  */
+  unsigned int chunkSize () const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -649,6 +697,10 @@ private:
 
   Convolver myConvolver; ///< Convolver
 
+  FFTConvolver myFFTConvolver; ///< FFT based convolver (ranges of surfels)
+
+  bool myUseFFT; ///< True if ranges of surfels are evaluated with myFFTConvolver
+
   double h; ///< precision of the grid
 
   double radius; ///< Euclidean radius of the kernel
@@ -699,6 +751,7 @@ public:
   typedef GaussDigitizer< Z3i::Space, EuclideanMinus > DigitalShape;
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, KSpace, DigitalShapeKernel> Convolver;
+  typedef DigitalSurfaceFFTConvolver<ShapeSpelFunctor, KSpace, DigitalShapeKernel> FFTConvolver;
 
   typedef typename Convolver::CovarianceMatrix Matrix3x3;
 
@@ -813,6 +866,37 @@ public:
                                  const SurfelIterator & ite,
                                  OutputIterator & result );
 
+  /**
+  * Chooses how ranges of surfels are evaluated: either with the
+  * incremental convolution on masks (default), or with the FFT based
+  * convolution on the bounding box of the surfels (see
+  * DigitalSurfaceFFTConvolver), which is faster for large kernels.
+  * Single surfel evaluations always use the incremental convolution.
+  *
+  * @param[in] aFlag true to evaluate ranges with FFT.
+  */
+  void setFFTConvolution ( const bool aFlag );
+
+  /**
+  * @return true if ranges of surfels are evaluated with FFT.
+  */
+  bool fftConvolution () const;
+
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * eval() on a range of surfels with the incremental convolution, when
+  * DGtal is built with OpenMP (see DigitalSurfaceConvolver::setChunkSize).
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel.
+  */
+  unsigned int chunkSize () const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -840,6 +924,10 @@ private:
 
   Convolver myConvolver; ///< Convolver
 
+  FFTConvolver myFFTConvolver; ///< FFT based convolver (ranges of surfels)
+
+  bool myUseFFT; ///< True if ranges of surfels are evaluated with myFFTConvolver
+
   double h; ///< precision of the grid
 
   double radius; ///< Euclidean radius of the kernel
@@ -48,6 +48,7 @@
 #include "DGtal/shapes/Shapes.h"
 
 #include "DGtal/geometry/surfaces/DigitalSurfaceConvolver.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.h"
 #include "DGtal/shapes/EuclideanShapesDecorator.h"
 
 #include "DGtal/shapes/implicit/ImplicitBall.h"
@@ -62,6 +63,8 @@ template< typename Quantity >
 class MeanCurvatureFunctor3 : std::unary_function <double,double>
 {
 public:
+  typedef Quantity Value;
+
 
   MeanCurvatureFunctor3(){}
 
@@ -92,6 +95,8 @@ template< typename Quantity >
 class MeanCurvatureFunctor2 : std::unary_function <double,double>
 {
 public:
+  typedef Quantity Value;
+
 
   MeanCurvatureFunctor2(){}
 
@@ -239,6 +244,21 @@ public:
               const SurfelIterator & ite,
               OutputIterator & result ) const;
 
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * eval() on a range of surfels with the incremental convolution, when
+  * DGtal is built with OpenMP (see DigitalSurfaceConvolver::setChunkSize).
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel.
+  */
+  unsigned int chunkSize () const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -319,6 +339,7 @@ public:
   typedef MeanCurvatureFunctor2< Quantity > ValuesFunctor;
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, KSpace, DigitalShapeKernel> Convolver;
+  typedef DigitalSurfaceFFTConvolver<ShapeSpelFunctor, KSpace, DigitalShapeKernel> FFTConvolver;
   typedef typename Convolver::PairIterators PairIterators;
 
   BOOST_CONCEPT_ASSERT (( CCellFunctor< ShapeSpelFunctor > ));
@@ -389,6 +410,37 @@ public:
               const SurfelIterator & ite,
               OutputIterator & result ) const;
 
+  /**
+  * Chooses how ranges of surfels are evaluated: either with the
+  * incremental convolution on masks (default), or with the FFT based
+  * convolution on the bounding box of the surfels (see
+  * DigitalSurfaceFFTConvolver), which is faster for large kernels.
+  * Single surfel evaluations always use the incremental convolution.
+  *
+  * @param[in] aFlag true to evaluate ranges with FFT.
+  */
+  void setFFTConvolution ( const bool aFlag );
+
+  /**
+  * @return true if ranges of surfels are evaluated with FFT.
+  */
+  bool fftConvolution () const;
+
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * eval() on a range of surfels with the incremental convolution, when
+  * DGtal is built with OpenMP (see DigitalSurfaceConvolver::setChunkSize).
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel.
+  */
+  unsigned int chunkSize () const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -416,6 +468,10 @@ private:
 
   Convolver myConvolver; ///< Convolver
 
+  FFTConvolver myFFTConvolver; ///< FFT based convolver (ranges of surfels)
+
+  bool myUseFFT; ///< True if ranges of surfels are evaluated with myFFTConvolver
+
   double h; ///< precision of the grid
 
   double radius; ///< Euclidean radius of the kernel
@@ -468,6 +524,7 @@ public:
   typedef MeanCurvatureFunctor3< Quantity > ValuesFunctor;
 
   typedef DigitalSurfaceConvolver<ShapeSpelFunctor, KernelSpelFunctor, KSpace, DigitalShapeKernel> Convolver;
+  typedef DigitalSurfaceFFTConvolver<ShapeSpelFunctor, KSpace, DigitalShapeKernel> FFTConvolver;
   typedef typename Convolver::PairIterators PairIterators;
 
   BOOST_CONCEPT_ASSERT (( CCellFunctor< ShapeSpelFunctor > ));
@@ -537,6 +594,37 @@ public:
               const SurfelIterator & ite,
               OutputIterator & result ) const;
 
+  /**
+  * Chooses how ranges of surfels are evaluated: either with the
+  * incremental convolution on masks (default), or with the FFT based
+  * convolution on the bounding box of the surfels (see
+  * DigitalSurfaceFFTConvolver), which is faster for large kernels.
+  * Single surfel evaluations always use the incremental convolution.
+  *
+  * @param[in] aFlag true to evaluate ranges with FFT.
+  */
+  void setFFTConvolution ( const bool aFlag );
+
+  /**
+  * @return true if ranges of surfels are evaluated with FFT.
+  */
+  bool fftConvolution () const;
+
+  /**
+  * Sets the number of surfels of the chunks evaluated in parallel by
+  * eval() on a range of surfels with the incremental convolution, when
+  * DGtal is built with OpenMP (see DigitalSurfaceConvolver::setChunkSize).
+  *
+  * @param[in] aChunkSize the number of surfels per chunk (default
+  * 4096), or 0 to always evaluate ranges sequentially.
+  */
+  void setChunkSize ( const unsigned int aChunkSize );
+
+  /**
+  * @return the number of surfels of the chunks evaluated in parallel.
+  */
+  unsigned int chunkSize () const;
+
   /**
   * Writes/Displays the object on an output stream.
   * @param out the output stream where the object is written.
@@ -564,6 +652,10 @@ private:
 
   Convolver myConvolver; ///< Convolver
 
+  FFTConvolver myFFTConvolver; ///< FFT based convolver (ranges of surfels)
+
+  bool myUseFFT; ///< True if ranges of surfels are evaluated with myFFTConvolver
+
   double h; ///< precision of the grid
 
   double radius; ///< Euclidean radius of the kernel
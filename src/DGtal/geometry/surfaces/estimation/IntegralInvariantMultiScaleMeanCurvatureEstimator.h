@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantMultiScaleMeanCurvatureEstimator.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IntegralInvariantMultiScaleMeanCurvatureEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see IntegralInvariantMeanCurvatureEstimator.h DigitalSurfaceFFTConvolver.h
+ */
+
+#if defined(IntegralInvariantMultiScaleMeanCurvatureEstimator_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantMultiScaleMeanCurvatureEstimator.h
+#else // defined(IntegralInvariantMultiScaleMeanCurvatureEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantMultiScaleMeanCurvatureEstimator_RECURSES
+
+#if !defined IntegralInvariantMultiScaleMeanCurvatureEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantMultiScaleMeanCurvatureEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/DigitalSurfaceFFTConvolver.h"
+#include "DGtal/kernel/CCellFunctor.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class IntegralInvariantMultiScaleMeanCurvatureEstimator
+/**
+* Description of template class 'IntegralInvariantMultiScaleMeanCurvatureEstimator' <p>
+* \brief Aim: This class computes the Integral Invariant mean curvature
+* estimations (see IntegralInvariantMeanCurvatureEstimator) of a
+* range of surfels for several kernel radii at once, e.g. for
+* scale-space analysis.
+*
+* The digital balls of the different radii are nested: the kernel of
+* each radius is the kernel of the previous radius and a shell of new
+* points. The kernels are digitized once, the surfels are traversed
+* once and the shape is sampled and transformed once on the bounding
+* box of the surfels dilated by the largest kernel, then the volume
+* fields of the nested kernels are obtained by FFT based convolutions,
+* two radii per transform (see DigitalSurfaceFFTConvolver). For each
+* surfel, the mean curvatures for all the radii are returned in a
+* std::vector, by increasing radius.
+*
+* The volumes, hence the estimations, are identical to the ones of
+* IntegralInvariantMeanCurvatureEstimator initialized independently
+* with each radius.
+*
+* @tparam TKSpace space in which the shape is defined.
+* @tparam TShapeFunctor TFunctor a model of a functor for the shape ( f(x) ).
+*
+* @see testIntegralInvariantMultiScaleMeanCurvatureEstimator.cpp
+*/
+template <typename TKSpace, typename TShapeFunctor>
+class IntegralInvariantMultiScaleMeanCurvatureEstimator
+{
+public:
+  typedef TKSpace KSpace;
+  typedef TShapeFunctor ShapeSpelFunctor;
+
+  typedef IntegralInvariantMeanCurvatureEstimator< KSpace, ShapeSpelFunctor > SingleScaleEstimator;
+  typedef typename SingleScaleEstimator::Domain Domain;
+  typedef typename SingleScaleEstimator::RealPoint RealPoint;
+  typedef typename SingleScaleEstimator::Quantity Quantity;
+  typedef std::vector< Quantity > Quantities;
+
+  typedef typename SingleScaleEstimator::KernelSupport KernelSupport;
+  typedef typename SingleScaleEstimator::DigitalShapeKernel DigitalShapeKernel;
+  typedef typename SingleScaleEstimator::ValuesFunctor ValuesFunctor;
+
+  typedef DigitalSurfaceFFTConvolver< ShapeSpelFunctor, KSpace, DigitalShapeKernel > Convolver;
+
+  BOOST_CONCEPT_ASSERT (( CCellFunctor< ShapeSpelFunctor > ));
+
+  // ----------------------- Standard services ------------------------------
+public:
+  /**
+  * Constructor.
+  *
+  * @param[in] space space in which the shape is defined.
+  * @param[in] f functor on spel of the shape.
+  */
+  IntegralInvariantMultiScaleMeanCurvatureEstimator ( ConstAlias< KSpace > space, ConstAlias< ShapeSpelFunctor > f );
+
+  /**
+  * Destructor.
+  */
+  ~IntegralInvariantMultiScaleMeanCurvatureEstimator();
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * Initialise the estimator with a set of Euclidean kernel radii, and grid step _h.
+  *
+  * @param[in] _h precision of the grid
+  * @param[in] radii Euclidean radii of the kernel supports (sorted by increasing values by the estimator).
+  */
+  void init ( const double _h, const std::vector< double > & radii );
+
+  /**
+  * -- Mean curvature --
+  * Compute the integral invariant mean curvatures, for all the radii,
+  * from two surfels (from *itb to *ite (exclude) ) of a shape.
+  * Return the result on an OutputIterator (param).
+  *
+  * @tparam SurfelIterator type of Iterator on a Surfel
+  * @tparam OutputIterator type of Iterator of an array of Quantities
+  *
+  * @param[in] itb iterator of the begin surfel on the shape we want compute the integral invariant mean curvature.
+  * @param[in] ite iterator of the end surfel (excluded) on the shape we want compute the integral invariant mean curvature.
+  * @param[out] result iterator of results of the computation: for each surfel, the mean curvatures by increasing radius.
+  */
+  template< typename SurfelIterator, typename OutputIterator >
+  void eval ( const SurfelIterator & itb,
+              const SurfelIterator & ite,
+              OutputIterator & result ) const;
+
+  /**
+  * @return the Euclidean radii of the kernels, by increasing values.
+  */
+  const std::vector< double > & radii () const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  std::vector< KernelSupport * > kernels; ///< Euclidean kernels, by increasing radius
+
+  std::vector< DigitalShapeKernel * > digKernels; ///< Digital kernels, by increasing radius
+
+  Convolver myConvolver; ///< FFT based convolver with nested kernels
+
+  double h; ///< precision of the grid
+
+  std::vector< double > myRadii; ///< Euclidean radii of the kernels, by increasing values
+
+  std::vector< ValuesFunctor > meanFunctors; ///< Functors to transform volumes to Quantity, one per radius
+
+private:
+
+  /**
+  * Deletes the kernels.
+  */
+  void clearKernels ();
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  IntegralInvariantMultiScaleMeanCurvatureEstimator ( const IntegralInvariantMultiScaleMeanCurvatureEstimator & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  IntegralInvariantMultiScaleMeanCurvatureEstimator & operator= ( const IntegralInvariantMultiScaleMeanCurvatureEstimator & other );
+
+}; // end of class IntegralInvariantMultiScaleMeanCurvatureEstimator
+
+
+/**
+* Overloads 'operator<<' for displaying objects of class 'IntegralInvariantMultiScaleMeanCurvatureEstimator'.
+* @param out the output stream where the object is written.
+* @param object the object of class 'IntegralInvariantMultiScaleMeanCurvatureEstimator' to write.
+* @return the output stream after the writing.
+*/
+template <typename TKS, typename TSF>
+std::ostream&
+operator<< ( std::ostream & out, const IntegralInvariantMultiScaleMeanCurvatureEstimator<TKS, TSF> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMultiScaleMeanCurvatureEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantMultiScaleMeanCurvatureEstimator_h
+
+#undef IntegralInvariantMultiScaleMeanCurvatureEstimator_RECURSES
+#endif // else defined(IntegralInvariantMultiScaleMeanCurvatureEstimator_RECURSES)
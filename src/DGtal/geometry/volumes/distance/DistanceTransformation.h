@@ -74,6 +74,10 @@ namespace DGtal
    * Please refer to VoronoiMap documentation for details on the
    * computational cost and parameter description.
    *
+   * After local modifications of the point predicate, the distance
+   * transformation can be repaired with VoronoiMap::update() instead
+   * of being computed again on the whole domain.
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TSpace type of Digital Space (model of CSpace).
@@ -143,10 +147,12 @@ namespace DGtal
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
+                           ConstAlias<SeparableMetric> aMetric,
+                           const bool updatable = false):
       VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
                                                                           predicate,
-                                                                          aMetric)
+                                                                          aMetric,
+                                                                          updatable)
     {}
     
     /**
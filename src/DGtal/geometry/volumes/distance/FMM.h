@@ -52,51 +52,17 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/images/ImageHelper.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/CPointFunctor.h"
 #include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
-  namespace details
-  {
-  /////////////////////////////////////////////////////////////////////////////
-  // template class PointValueCompare
-  /**
-   * Description of template class 'PointValueCompare' <p>
-   * \brief Aim: Small binary predicate to order candidates points 
-   * according to their (absolute) distance value. 
-   *
-   * @tparam T model of pair Point-Value
-   */
-    template<typename T>
-    class PointValueCompare {
-    public: 
-      /**
-       * Comparison function
-       *
-       * @param a an object of type T
-       * @param b another object of type T
-       *
-       * @return true if a < b but false otherwise
-       */
-      bool operator()(const T& a, const T& b) 
-      {
-	if ( std::abs(a.second) == std::abs(b.second) ) 
-	  { //point comparison
-	    return (a.first < b.first); 
-	  }
-	else //distance comparison
-	  //(in absolute value in order to deal with
-	  //signed distance values) 
-	  return ( std::abs(a.second) < std::abs(b.second) ); 
-      }
-    };
-  }
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -122,8 +88,20 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a container of pairs (point, 
+   * tentative value), which is by default a STL set (FMMCandidateSet). 
+   * A binary heap (FMMCandidateHeap) or a bucketed heap
+   * (FMMCandidateBucketQueue) may be used instead in order to speed
+   * up the propagation on large images; since they all pop the
+   * candidates in the same order, the results do not depend on
+   * this choice. 
+   * @see FMMCandidateQueues.h
+   *
+   * The set of accepted points is searched each time a candidate
+   * is tested or its tentative value computed. On large images,
+   * a DigitalSetByBitVector on the domain of the image should be
+   * preferred to a DigitalSetBySTLSet: the search is then a bit
+   * test instead of a tree search.
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -131,6 +109,9 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TCandidateQueue  container of candidate points 
+   * (FMMCandidateSet, FMMCandidateHeap or FMMCandidateBucketQueue
+   * instantiated with Point and Value types)
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMDef
@@ -143,7 +124,9 @@ namespace DGtal
    * @see testFMM.cpp
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>,
+	    typename TCandidateQueue = FMMCandidateSet<typename TImage::Point,
+						       typename TPointFunctor::Value> >
   class FMM
   {
 
@@ -180,8 +163,8 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     details::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef TCandidateQueue CandidatePointSet; 
+    BOOST_STATIC_ASSERT(( boost::is_same< PointValue, typename CandidatePointSet::PointValue >::value ));
     typedef unsigned long Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -503,6 +486,29 @@ namespace DGtal
      */
     bool addNewCandidate(const Point& aPoint);
 
+    /** 
+     * Tests whether @a aPoint is an accepted point. 
+     *
+     * @param aSet any digital set
+     * @param aPoint any point
+     *
+     * @return 'true' if @a aPoint belongs to @a aSet
+     */
+    template <typename TAnySet>
+    static bool isAccepted(const TAnySet& aSet, const Point& aPoint);
+
+    /** 
+     * Tests whether @a aPoint is an accepted point 
+     * (bit test, without building an iterator). 
+     *
+     * @param aSet a digital set stored as a bit vector
+     * @param aPoint any point
+     *
+     * @return 'true' if @a aPoint belongs to @a aSet
+     */
+    template <typename TDomain>
+    static bool isAccepted(const DigitalSetByBitVector<TDomain>& aSet, const Point& aPoint);
+
 
   }; // end of class FMM
 
@@ -513,9 +519,9 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor, typename TCandidateQueue >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TCandidateQueue> & object );
 
 } // namespace DGtal
 
@@ -0,0 +1,467 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidateQueues.h
+ * @brief Containers of candidate points for the Fast Marching Method
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module FMMCandidateQueues.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testFMMCandidateQueues.cpp
+ */
+
+#if defined(FMMCandidateQueues_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidateQueues.h
+#else // defined(FMMCandidateQueues_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidateQueues_RECURSES
+
+#if !defined FMMCandidateQueues_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidateQueues_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace details
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueGreater
+  /**
+   * Description of template class 'PointValueGreater' <p>
+   * \brief Aim: Reversed PointValueCompare, so that the STL heap
+   * algorithms (max-heaps) put the candidate of min distance first.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueGreater {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if b < a but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+        return PointValueCompare<T>()( b, a );
+      }
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMCandidateSet
+  /**
+   * Description of template class 'FMMCandidateSet' <p>
+   * \brief Aim: Container of the candidate points of FMM, based on a
+   * STL set of pairs (point, tentative value) ordered by
+   * details::PointValueCompare (default FMM container).
+   *
+   * Like the other candidate containers (FMMCandidateHeap,
+   * FMMCandidateBucketQueue), it provides:
+   * - push(v): inserts a pair (point, tentative value),
+   * - top(): returns the pair of min absolute value (ties are broken
+   * by point comparison),
+   * - pop(): removes the pair returned by top(),
+   * - empty(), size(), clear().
+   *
+   * A point may be inserted several times with different tentative
+   * values (FMM discards the obsolete ones when they are popped). All
+   * containers pop the pairs in the same order, so that FMM results
+   * do not depend on the container.
+   *
+   * Each operation is in O(log n) with one node allocation per
+   * insertion.
+   *
+   * @tparam TPoint a point type.
+   * @tparam TValue a (signed) distance value type.
+   */
+  template <typename TPoint, typename TValue>
+  class FMMCandidateSet
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::set<PointValue, details::PointValueCompare<PointValue> > Container;
+
+    /// Inserts the pair @a aPair.
+    void push( const PointValue &aPair )
+    {
+      myContainer.insert( aPair );
+    }
+
+    /// @return the pair of min distance (the container must not be empty).
+    const PointValue & top() const
+    {
+      ASSERT( !myContainer.empty() );
+      return *myContainer.begin();
+    }
+
+    /// Removes the pair of min distance.
+    void pop()
+    {
+      ASSERT( !myContainer.empty() );
+      myContainer.erase( myContainer.begin() );
+    }
+
+    /// @return 'true' if the container is empty.
+    bool empty() const
+    {
+      return myContainer.empty();
+    }
+
+    /// @return the number of pairs in the container.
+    typename Container::size_type size() const
+    {
+      return myContainer.size();
+    }
+
+    /// Removes all the pairs.
+    void clear()
+    {
+      myContainer.clear();
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[FMMCandidateSet] size=" << size();
+    }
+
+  private:
+    /// STL set of pairs
+    Container myContainer;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMCandidateHeap
+  /**
+   * Description of template class 'FMMCandidateHeap' <p>
+   * \brief Aim: Container of the candidate points of FMM, based on a
+   * binary heap stored in a contiguous array.
+   *
+   * Same ordering as FMMCandidateSet (see its description for the
+   * interface), but without node allocations and pointer chasing:
+   * operations are in O(log n) on a std::vector.
+   *
+   * @tparam TPoint a point type.
+   * @tparam TValue a (signed) distance value type.
+   */
+  template <typename TPoint, typename TValue>
+  class FMMCandidateHeap
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::vector<PointValue> Container;
+
+    /// Inserts the pair @a aPair.
+    void push( const PointValue &aPair );
+
+    /// @return the pair of min distance (the container must not be empty).
+    const PointValue & top() const
+    {
+      ASSERT( !myContainer.empty() );
+      return myContainer.front();
+    }
+
+    /// Removes the pair of min distance.
+    void pop();
+
+    /// @return 'true' if the container is empty.
+    bool empty() const
+    {
+      return myContainer.empty();
+    }
+
+    /// @return the number of pairs in the container.
+    typename Container::size_type size() const
+    {
+      return myContainer.size();
+    }
+
+    /// Removes all the pairs.
+    void clear()
+    {
+      myContainer.clear();
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[FMMCandidateHeap] size=" << size();
+    }
+
+  private:
+    /// Heap of pairs
+    Container myContainer;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMCandidateBucketQueue
+  /**
+   * Description of template class 'FMMCandidateBucketQueue' <p>
+   * \brief Aim: Container of the candidate points of FMM, based on a
+   * bucketed heap with quantized keys.
+   *
+   * Pairs are stored in buckets according to the quantized absolute
+   * value floor(|value| / width). Only the bucket of lowest index is
+   * organized as a binary heap: insertions in other buckets are in
+   * O(1) (a push_back in an array), and heap operations only involve
+   * the few candidates of the current bucket. Since FMM tentative
+   * values are never lower than the last accepted value, the buckets
+   * are consumed in increasing order; pairs whose key is lower than
+   * the current bucket are nevertheless handled (they are put in the
+   * current heap), so that the pairs are popped in exactly the same
+   * order as FMMCandidateSet (see its description for the
+   * interface). The bucket width thus only affects performances.
+   *
+   * The buckets following the current one form a circular window of
+   * a fixed number of buckets; pairs beyond the window go to a single
+   * overflow bucket, which is redistributed when the window reaches
+   * its lowest key. The memory used is thus bounded by the number of
+   * pairs and the size of the window, whatever the pushed values.
+   *
+   * @tparam TPoint a point type.
+   * @tparam TValue a (signed) distance value type.
+   */
+  template <typename TPoint, typename TValue>
+  class FMMCandidateBucketQueue
+  {
+  public:
+    typedef TPoint Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::vector<PointValue> Bucket;
+    typedef typename Bucket::size_type Size;
+
+    /**
+     * Constructor.
+     * @param aWidth width of the buckets (in distance unit, strictly
+     * positive). Default value: 1/16.
+     * @param aNbBuckets number of buckets of the window following the
+     * current bucket (strictly positive). Default value: 64, i.e. 4
+     * distance units with the default width, which is more than the
+     * range of the FMM candidates.
+     */
+    FMMCandidateBucketQueue( const double aWidth = 0.0625,
+                             const unsigned int aNbBuckets = 64 );
+
+    /// Inserts the pair @a aPair.
+    void push( const PointValue &aPair );
+
+    /// @return the pair of min distance (the container must not be empty).
+    const PointValue & top() const
+    {
+      ASSERT( !myHeap.empty() );
+      return myHeap.front();
+    }
+
+    /// Removes the pair of min distance.
+    void pop();
+
+    /// @return 'true' if the container is empty.
+    bool empty() const
+    {
+      return mySize == 0;
+    }
+
+    /// @return the number of pairs in the container.
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /// Removes all the pairs.
+    void clear();
+
+    /// @return the width of the buckets.
+    double width() const
+    {
+      return myWidth;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+  private:
+
+    /**
+     * @param aValue a distance value.
+     * @return the index of the bucket of @a aValue.
+     */
+    long key( const Value &aValue ) const
+    {
+      return static_cast<long>( std::floor( std::abs( static_cast<double>( aValue ) ) / myWidth ) );
+    }
+
+    /**
+     * Moves the next non empty bucket into the heap if the heap is
+     * empty.
+     */
+    void refill();
+
+    /**
+     * Puts the pair @a aPair of key @a aKey in the heap, in the
+     * window or in the overflow bucket.
+     */
+    void store( const PointValue &aPair, const long aKey );
+
+    /**
+     * Moves the pairs of the overflow bucket whose key is in the
+     * window (or lower) into the heap and the window.
+     */
+    void redistribute();
+
+  private:
+    /// Width of the buckets
+    double myWidth;
+
+    /// Heap of the pairs of the current bucket
+    Bucket myHeap;
+
+    /// Index of the current bucket
+    long myCurrentKey;
+
+    /// Circular window of the buckets of index myCurrentKey+1, ...,
+    /// myCurrentKey+myBuckets.size()
+    std::vector<Bucket> myBuckets;
+
+    /// Position in myBuckets of the bucket of index myCurrentKey+1
+    std::size_t myFirst;
+
+    /// Number of pairs in the window
+    Size myWindowSize;
+
+    /// Pairs beyond the window
+    Bucket myOverflow;
+
+    /// Lowest key of myOverflow (if not empty)
+    long myOverflowKey;
+
+    /// Number of pairs
+    Size mySize;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FMMCandidateSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FMMCandidateSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const FMMCandidateSet<TPoint, TValue> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FMMCandidateHeap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FMMCandidateHeap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const FMMCandidateHeap<TPoint, TValue> & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FMMCandidateBucketQueue'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FMMCandidateBucketQueue' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TPoint, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const FMMCandidateBucketQueue<TPoint, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidateQueues_h
+
+#undef FMMCandidateQueues_RECURSES
+#endif // else defined(FMMCandidateQueues_RECURSES)
@@ -53,6 +53,7 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/SeparablePassEngine.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -81,6 +82,10 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * As in VoronoiMap, each dimension pass is driven by a
+   * SeparablePassEngine (cache-blocked and multithreaded if DGtal
+   * has been built with OpenMP support).
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TWeightImage model of CConstImage
@@ -142,6 +147,9 @@ namespace DGtal
   
     ///Self type
   typedef PowerMap<TWeightImage, TPowerSeparableMetric, TImageContainer> Self;
+
+    ///Type of the engine driving the dimension passes
+    typedef SeparablePassEngine<OutputImage> PassEngine;
     
 
     /**
@@ -258,10 +266,36 @@ namespace DGtal
      * dim.
      * 
      * @param row starting point of the 1D process.
+     * @param endpoint last point of the 1D process.
      * @param dim dimension of the update.
+     * @param line the map values along the span (updated in place).
+     * @return true if @a line has been modified.
+     */
+    bool computeOtherStep1D (const Point &row,
+                             const Point &endpoint,
+			     const Dimension dim,
+                             Value *line) const;
+
+    /**
+     * Line processor handed to the SeparablePassEngine: forwards each
+     * 1D problem to computeOtherStep1D.
      */
-    void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+    struct LineProcessor
+    {
+      /// Constructor from the Power map to compute.
+      LineProcessor( const Self *aMap ): myMap( aMap ) {}
+
+      /// Solves one 1D problem (see computeOtherStep1D).
+      bool operator()( const Point &row, const Point &endpoint,
+                       const Dimension dim, Value *line ) const
+      {
+        return myMap->computeOtherStep1D( row, endpoint, dim, line );
+      }
+
+      /// Power map to compute.
+      const Self *myMap;
+    };
+    friend struct LineProcessor;
     
     // ------------------- protected methods ------------------------
   protected:
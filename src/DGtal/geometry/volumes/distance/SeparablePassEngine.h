@@ -0,0 +1,319 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SeparablePassEngine.h
+ * @brief Cache-blocked driver for the 1D passes of separable algorithms
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SeparablePassEngine.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testSeparablePassEngine.cpp
+ */
+
+#if defined(SeparablePassEngine_RECURSES)
+#error Recursive header files inclusion detected in SeparablePassEngine.h
+#else // defined(SeparablePassEngine_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SeparablePassEngine_RECURSES
+
+#if !defined SeparablePassEngine_h
+/** Prevents repeated inclusion of headers. */
+#define SeparablePassEngine_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/CImage.h"
+#if !defined(WITH_OPENMP) && defined(WITH_BOOST_THREAD)
+#include <boost/bind/bind.hpp>
+#include <boost/ref.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SeparablePassEngine
+  /**
+   * Description of template class 'SeparablePassEngine' <p>
+   * \brief Aim: Drives one dimension pass of a separable algorithm
+   * (VoronoiMap, PowerMap, DistanceTransformation...) over an
+   * image defined on a hyper-rectangular domain.
+   *
+   * A separable pass along dimension @a dim solves independent 1D
+   * problems on each line of the domain parallel to the axis @a
+   * dim. Instead of reading each line point by point in the image
+   * (which strides across the whole container along non-leading
+   * axes), the engine processes bundles of adjacent lines: the values
+   * of a bundle are transposed into a contiguous scratch buffer (one
+   * line after the other), each line is solved in this buffer by the
+   * user line processor, and modified lines are written back to the
+   * image. Lines of a bundle are taken along the fastest axis
+   * different from @a dim so that reading and writing a bundle both
+   * scan the image container contiguously.
+   *
+   * Bundles are enumerated from their linear index (no starting point
+   * list is materialized). If DGtal has been built with OpenMP support
+   * (WITH_OPENMP flag set to "true"), bundles are processed in
+   * parallel, each thread owning its scratch buffer. Otherwise, if
+   * DGtal has been built with Boost.Thread support (WITH_BOOST_THREAD
+   * flag set to "true"), bundles are processed in parallel by one
+   * boost::thread per hardware thread, each thread taking the next
+   * bundle to process. Parallel processing can be disabled at
+   * construction for images whose accessors are not thread-safe
+   * (e.g. TiledImage).
+   *
+   * The line processor is a functor with the following signature:
+   * @code
+   * bool operator()(const Point &startingPoint, const Point &endPoint,
+   *                 const Dimension dim, Value *line) const;
+   * @endcode
+   * where @a line points to the @a endPoint[dim]-@a startingPoint[dim]+1
+   * values of the line. It must return true if the line values have
+   * been modified (and thus must be written back). Since lines are
+   * solved concurrently, the processor must be reentrant.
+   *
+   * @tparam TImage type of image to process (model of CImage on a
+   * HyperRectDomain).
+   *
+   * @see VoronoiMap, PowerMap
+   */
+  template <typename TImage>
+  class SeparablePassEngine
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( CImage<TImage> ));
+
+    ///Image type
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Value Value;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Space::Dimension Dimension;
+    typedef typename Domain::Space::Size Size;
+    typedef typename Point::Coordinate Abscissa;
+
+    ///Default number of lines transposed together.
+    BOOST_STATIC_CONSTANT( Size, defaultBundleSize = 16 );
+
+    /**
+     * Constructor.
+     *
+     * @param aLowerBound lower bound of the region to process.
+     * @param anUpperBound upper bound of the region to process.
+     * @param aBundleSize number of adjacent lines transposed and
+     * processed together (must be strictly positive).
+     * @param isParallel if true (default), bundles are processed in
+     * parallel when DGtal has been built with OpenMP or Boost.Thread
+     * support.
+     */
+    SeparablePassEngine( const Point &aLowerBound,
+                         const Point &anUpperBound,
+                         const Size aBundleSize = defaultBundleSize,
+                         const bool isParallel = true );
+
+    /**
+     * Destructor.
+     */
+    ~SeparablePassEngine();
+
+    /**
+     * Runs the pass along dimension @a dim: every line of the region
+     * parallel to the axis @a dim is handed to @a aProcessor.
+     *
+     * @param anImage the image to update in place.
+     * @param dim the dimension of the pass.
+     * @param aProcessor the line processor (see class description).
+     */
+    template <typename TLineProcessor>
+    void run( Image &anImage,
+              const Dimension dim,
+              const TLineProcessor &aProcessor ) const;
+
+    /**
+     * @param dim a dimension.
+     * @return the number of lines processed by a pass along @a dim.
+     */
+    Size nbLines( const Dimension dim ) const;
+
+    /**
+     * @return the number of lines transposed together.
+     */
+    Size bundleSize() const
+    {
+      return myBundleSize;
+    }
+
+    /**
+     * @return true if bundles may be processed in parallel.
+     */
+    bool isParallel() const
+    {
+      return myIsParallel;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private types --------------------------
+  private:
+
+    ///Parameters of a pass
+    struct Pass
+    {
+      ///Dimension of the pass
+      Dimension dim;
+      ///Axis along which the lines of a bundle are stacked
+      Dimension axis;
+      ///Number of points of a line
+      Size lineSize;
+      ///Number of lines per bundle
+      Size bundleSize;
+      ///Number of bundles
+      Size nbBundles;
+      ///True if the lines are contiguous in the image
+      bool alongLines;
+    };
+
+#if !defined(WITH_OPENMP) && defined(WITH_BOOST_THREAD)
+    ///Index of the next bundle to process, shared by the threads
+    struct BundleCounter
+    {
+      Size next;
+      boost::mutex mutex;
+    };
+#endif
+
+    // ------------------------- Private methods ------------------------
+  private:
+
+    /**
+     * @param dim the dimension of the pass.
+     * @return the axis along which the lines of a bundle are stacked
+     * (Domain::dimension if lines cannot be bundled, i.e. in 1D).
+     */
+    Dimension bundleAxis( const Dimension dim ) const;
+
+    /**
+     * Decodes the starting point of a bundle from its linear index.
+     *
+     * @param index linear index of the bundle.
+     * @param dim the dimension of the pass.
+     * @param axis the bundle axis.
+     * @return the starting point of the first line of the bundle.
+     */
+    Point bundleStart( Size index,
+                       const Dimension dim,
+                       const Dimension axis ) const;
+
+    /**
+     * Transposes a bundle into the scratch buffers, solves its lines
+     * and writes back the modified ones.
+     *
+     * @param anImage the image to update in place.
+     * @param aPass the parameters of the pass.
+     * @param aProcessor the line processor.
+     * @param b linear index of the bundle.
+     * @param buffer scratch buffer of the bundle values.
+     * @param modified scratch buffer of the modified line flags.
+     */
+    template <typename TLineProcessor>
+    void processBundle( Image &anImage,
+                        const Pass &aPass,
+                        const TLineProcessor &aProcessor,
+                        const Size b,
+                        std::vector<Value> &buffer,
+                        std::vector<char> &modified ) const;
+
+#if !defined(WITH_OPENMP) && defined(WITH_BOOST_THREAD)
+    /**
+     * Body of a thread: processes bundles until they are all taken.
+     *
+     * @param anImage the image to update in place.
+     * @param aPass the parameters of the pass.
+     * @param aProcessor the line processor.
+     * @param aCounter index of the next bundle to process.
+     */
+    template <typename TLineProcessor>
+    void processBundles( Image &anImage,
+                         const Pass &aPass,
+                         const TLineProcessor &aProcessor,
+                         BundleCounter &aCounter ) const;
+#endif
+
+    // ------------------------- Private Datas --------------------------
+  private:
+
+    ///Lower bound of the processed region
+    Point myLowerBound;
+
+    ///Upper bound of the processed region
+    Point myUpperBound;
+
+    ///Number of lines per bundle
+    Size myBundleSize;
+
+    ///True if bundles may be processed in parallel
+    bool myIsParallel;
+
+  }; // end of class SeparablePassEngine
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SeparablePassEngine'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SeparablePassEngine' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const SeparablePassEngine<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/SeparablePassEngine.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SeparablePassEngine_h
+
+#undef SeparablePassEngine_RECURSES
+#endif // else defined(SeparablePassEngine_RECURSES)
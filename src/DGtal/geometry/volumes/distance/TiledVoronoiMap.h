@@ -0,0 +1,347 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TiledVoronoiMap.h
+ * @brief Out-of-core separable Voronoi map computation on a TiledImage
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module TiledVoronoiMap.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testTiledVoronoiMap.cpp
+ */
+
+#if defined(TiledVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in TiledVoronoiMap.h
+#else // defined(TiledVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TiledVoronoiMap_RECURSES
+
+#if !defined TiledVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define TiledVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/SeparablePassEngine.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class TiledVoronoiMap
+  /**
+   * Description of template class 'TiledVoronoiMap' <p>
+   * \brief Aim: Out-of-core computation of the Voronoi map (and of
+   * the distance transformation) of a point predicate, the map being
+   * stored in a TiledImage.
+   *
+   * The map is the same as the one of VoronoiMap (same sites, same
+   * choice between equidistant sites) but it is never held in memory
+   * as a whole: the values are read and written through the
+   * TiledImage cache, and tiles leaving the cache are spilled to the
+   * storage of the tiled image factory (e.g. a raw file with
+   * ImageFactoryFromRawFile).
+   *
+   * The computation is organized to keep the working set small:
+   * - the initialization step is performed tile by tile;
+   * - the pass along dimension @a dim is performed slab by slab, a
+   * slab being a row of tiles along the axis @a dim (i.e. the tiles
+   * sharing the same position along the other axes). Each slab is
+   * processed by a SeparablePassEngine (sequential since TiledImage
+   * accessors are not thread-safe).
+   *
+   * The memory budget is thus driven by the tile size and by the
+   * cache size: with @f$ N @f$ tiles along each axis, a cache of at
+   * least @f$ N @f$ tiles (e.g. ImageCacheReadPolicyFIFO of size
+   * @f$ N+1 @f$) holds a whole slab, and each tile is loaded once per
+   * dimension pass. With a smaller cache, the computation is still
+   * correct but tiles are reloaded for each bundle of lines.
+   *
+   * The tiled image factory must be writable (its values are
+   * overwritten by the map) and the cache write policy must keep the
+   * updates (ImageCacheWritePolicyWB or ImageCacheWritePolicyWT).
+   *
+   * This class is a model of CConstImage.
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of CPointPredicate)
+   * @tparam TSeparableMetric a model of CSeparableMetric
+   * @tparam TTiledImage the tiled image type storing the map (e.g.
+   * TiledImage), a model of CImage on a HyperRectDomain of TSpace
+   * whose value type is TSpace::Point, providing the tile containing
+   * a point with findSubDomain.
+   *
+   * @see VoronoiMap, TiledImage, ImageFactoryFromRawFile
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TTiledImage >
+  class TiledVoronoiMap
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( CSeparableMetric<TSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( CImage<TTiledImage> ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    //TTiledImage::Domain::Space must match with TSpace
+    BOOST_STATIC_ASSERT ((boost::is_same< TSpace,
+                          typename TTiledImage::Domain::Space >::value ));
+
+    //TTiledImage value type must be TSpace::Point
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TTiledImage::Value >::value ));
+
+    //TTiledImage domain type must be HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<TSpace>,
+                          typename TTiledImage::Domain >::value ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Copy of the separable metric type.
+    typedef TSeparableMetric SeparableMetric;
+
+    ///Copy of the tiled image type.
+    typedef TTiledImage TiledImage;
+
+    ///Definition of the underlying domain type.
+    typedef typename TiledImage::Domain Domain;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Definition of the image value type (the closest site).
+    typedef Point Value;
+
+    ///Type of the distance values.
+    typedef typename SeparableMetric::Value DistanceValue;
+
+    ///Self type
+    typedef TiledVoronoiMap<TSpace, TPointPredicate, TSeparableMetric, TTiledImage> Self;
+
+    ///Type of the engine driving the passes on each slab
+    typedef SeparablePassEngine<TiledImage> PassEngine;
+
+    ///Type of the 1D step handed to the engine
+    typedef VoronoiLineProcessor<SeparableMetric> LineProcessor;
+
+    /**
+     * Constructor.
+     *
+     * Computes the Voronoi map of the points for which the predicate
+     * is false and stores it in @a aTiledImage (whose previous
+     * values are overwritten). The computation domain is the tiled
+     * image domain.
+     *
+     * @param aTiledImage the tiled image storing the map (aliased).
+     * @param aPredicate a predicate returning true for points from
+     * which we compute the distance (aliased).
+     * @param aMetric a separable metric instance (aliased).
+     * @param aBundleSize number of adjacent lines transposed together
+     * by the pass engine in each slab.
+     */
+    TiledVoronoiMap( Alias<TiledImage> aTiledImage,
+                     ConstAlias<PointPredicate> aPredicate,
+                     ConstAlias<SeparableMetric> aMetric,
+                     const Size aBundleSize = PassEngine::defaultBundleSize );
+
+    /**
+     * Default destructor
+     */
+    ~TiledVoronoiMap();
+
+  public:
+    // ------------------- ConstImage model ------------------------
+
+    /**
+     * Returns a reference (const) to the Voronoi map domain.
+     *  @return a domain
+     */
+    const Domain & domain() const
+    {
+      return myTiledImagePtr->domain();
+    }
+
+    /**
+     * Access to the closest site of a point (the point itself if it
+     * is a site).
+     *
+     * @param aPoint the point to probe.
+     * @return the closest site of @a aPoint.
+     */
+    Value operator()( const Point &aPoint ) const
+    {
+      return myTiledImagePtr->operator()( aPoint );
+    }
+
+    /**
+     * Access to the distance transformation value at a point (i.e.
+     * the distance to its closest site for the metric).
+     *
+     * @param aPoint the point to probe.
+     * @return the distance of @a aPoint to its closest site.
+     */
+    DistanceValue distance( const Point &aPoint ) const
+    {
+      return myMetricPtr->operator()( aPoint,
+                                      myTiledImagePtr->operator()( aPoint ) );
+    }
+
+    /**
+     * @return  Returns the underlying metric.
+     */
+    const SeparableMetric* metricPtr() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * @return  Returns the tiled image storing the map.
+     */
+    TiledImage* tiledImagePtr() const
+    {
+      return myTiledImagePtr;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /**
+     * Computes the tile boundaries along each axis.
+     */
+    void computeTileBounds();
+
+    /**
+     * Moves to the next tile of the domain (or of a slab).
+     *
+     * @param [in,out] tile the tile indices along each axis.
+     * @param [in] fixed axis along which the tile index is not
+     * incremented (Space::dimension to enumerate all tiles).
+     * @return false once all tiles have been visited.
+     */
+    bool nextTile( std::vector<Size> &tile, const Dimension fixed ) const;
+
+    /**
+     * Computes the Voronoi map (initialization and dimension passes).
+     */
+    void compute();
+
+    /**
+     * Sets, tile by tile, the sites (points for which the predicate
+     * is false) and the infinity value elsewhere.
+     */
+    void computeFirstStep();
+
+    /**
+     * Computes the pass along dimension @a dim, slab by slab.
+     *
+     * @param dim the dimension to process
+     */
+    void computeOtherSteps( const Dimension dim );
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the tiled image storing the map
+    TiledImage * myTiledImagePtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Number of lines per bundle in the pass engine
+    Size myBundleSize;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+    ///Lower coordinate of each tile along each axis (plus the end
+    ///of the domain)
+    std::vector< std::vector<Abscissa> > myTileBounds;
+
+  }; // end of class TiledVoronoiMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TiledVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TiledVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename Sep, typename TI>
+  std::ostream&
+  operator<< ( std::ostream & out, const TiledVoronoiMap<S,P,Sep,TI> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/TiledVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TiledVoronoiMap_h
+
+#undef TiledVoronoiMap_RECURSES
+#endif // else defined(TiledVoronoiMap_RECURSES)
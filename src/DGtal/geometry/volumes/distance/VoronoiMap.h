@@ -51,6 +51,7 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/SeparablePassEngine.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -58,6 +59,66 @@
 namespace DGtal
 {
 
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VoronoiLineProcessor
+  /**
+   * Description of template class 'VoronoiLineProcessor' <p>
+   * \brief Aim: 1D step of the separable Voronoi map construction
+   * (see VoronoiMap), as a line processor for SeparablePassEngine.
+   *
+   * Given the sites of a line (map values at dimension @a dim-1,
+   * the infinity value standing for "no site"), the sites hidden
+   * on the line by their neighbors are pruned and each point of the
+   * line is mapped to its closest remaining site.
+   *
+   * The processor only reads its members, hence it can be used
+   * concurrently on several lines.
+   *
+   * @tparam TSeparableMetric a model of CSeparableMetric
+   */
+  template <typename TSeparableMetric>
+  struct VoronoiLineProcessor
+  {
+    BOOST_CONCEPT_ASSERT(( CSeparableMetric<TSeparableMetric> ));
+
+    typedef TSeparableMetric SeparableMetric;
+    typedef typename SeparableMetric::Point Point;
+    typedef typename Point::Coordinate Abscissa;
+
+    /**
+     * Constructor.
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     * @param anInfinity the value standing for "no site".
+     */
+    VoronoiLineProcessor( const SeparableMetric *aMetric,
+                          const Point &anInfinity ):
+      myMetricPtr( aMetric ), myInfinity( anInfinity )
+    {}
+
+    /**
+     * Given  a voronoi map valid at dimension @a dim-1, updates the
+     * map values of the line to make them consistent at dimension @a
+     * dim.
+     *
+     * @param [in] startingPoint starting point of the 1D process.
+     * @param [in] endpoint last point of the 1D process.
+     * @param [in] dim dimension of the update.
+     * @param [in,out] line the map values along the line.
+     * @return true if @a line has been modified.
+     */
+    bool operator()( const Point &startingPoint,
+                     const Point &endpoint,
+                     const Dimension dim,
+                     Point *line ) const;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric *myMetricPtr;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class VoronoiMap
   /**
@@ -86,10 +147,19 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * Each dimension pass is driven by a SeparablePassEngine: bundles
+   * of adjacent 1D lines are transposed into a scratch buffer before
+   * being processed, so that passes along non-leading axes do not
+   * stride across the whole image container. If DGtal has been built
+   * with OpenMP support (WITH_OPENMP flag set to "true"), bundles are
+   * processed in parallel (multithreaded) in an optimal way: on @a p
+   * processors, expected runtime is in @f$ O(h.d.n^d / p)@f$.
+   *
+   * Once computed, the map can be repaired after local modifications
+   * of the point predicate (sites inserted or removed) with the
+   * update() method. The result is identical to the map computed from
+   * scratch on the modified predicate, but only the 1D lines whose
+   * input changed are processed again at each dimension pass.
    *
    * This class is a model of CConstImage.
    *
@@ -166,6 +236,12 @@ namespace DGtal
     ///Self type
     typedef VoronoiMap<TSpace, TPointPredicate, 
 		       TSeparableMetric,TImageContainer> Self;
+
+    ///Type of the engine driving the dimension passes
+    typedef SeparablePassEngine<OutputImage> PassEngine;
+
+    ///Type of the 1D step handed to the engine
+    typedef VoronoiLineProcessor<SeparableMetric> LineProcessor;
     
 
     /**
@@ -185,10 +261,15 @@ namespace DGtal
      * Voronoi sites (false points).
      * 
      *@param aMetric a pointer to the separable metric instance.
+     *
+     * @param updatable if true, the maps obtained after the
+     * intermediate dimension passes are kept so that the map can be
+     * incrementally repaired with update() (d-1 additional images).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               const bool updatable = false);
 
     /**
      * Default destructor
@@ -244,6 +325,33 @@ namespace DGtal
       return myMetricPtr;
     }
 
+    /**
+     * Updates the Voronoi map after local modifications of the point
+     * predicate: the predicate values at the points of [@a itb, @a
+     * ite) may have changed since the map computation (inserted or
+     * removed sites). Other points of the domain must keep their
+     * predicate value.
+     *
+     * At each dimension pass, only the 1D lines whose input values
+     * changed are processed again, so that the cost is proportional
+     * to the region of the map affected by the modifications (if most
+     * lines of a pass are affected, the remaining passes are
+     * processed as a whole). The resulting map is identical to the
+     * one computed from scratch with the modified predicate.
+     *
+     * To do so, the maps obtained after the intermediate dimension
+     * passes are kept (d-1 additional images). They are computed by
+     * the constructor when it is given @a updatable = true. Otherwise,
+     * the first call to update() recomputes the whole map to get them
+     * (full construction cost); subsequent calls are incremental.
+     *
+     * @param itb an iterator on the first modified point.
+     * @param ite an iterator after the last modified point.
+     * @tparam PointIterator a model of input iterator on Point.
+     */
+    template <typename PointIterator>
+    void update( PointIterator itb, PointIterator ite );
+
     /**
      * Self Display method.
      * 
@@ -259,8 +367,11 @@ namespace DGtal
      * SeparableMetric metric.  The method associates to each point
      * satisfying the foreground predicate, the closest site for which
      * the predicate is false. This algorithm is O(h.d.|domain size|).
+     *
+     * @param storePartialMaps if true, the maps obtained after the
+     * intermediate dimension passes are kept for further updates.
      */
-    void compute ( ) ;
+    void compute ( const bool storePartialMaps = false ) ;
 
 
     /** 
@@ -269,17 +380,29 @@ namespace DGtal
      * @param [in] dim the dimension to process
      */    
     void computeOtherSteps(const Dimension dim) const;
-    /** 
-     * Given  a voronoi map valid at dimension @a dim-1, this method
-     * updates the map to make it consistent at dimension @a dim along
-     * the 1D span starting at @a row along the dimension @a
-     * dim.
-     * 
-     * @param [in] row starting point of the 1D process.
-     * @param [in] dim dimension of the update.
+
+    /**
+     * Processes again the lines of the pass along dimension @a dim
+     * starting at the points of @a lines, and collects the lines of
+     * the next pass whose input values changed.
+     *
+     * @param [in] dim the dimension to process.
+     * @param [in] lines the starting points of the lines to process.
+     * @param [out] nextLines the starting points of the lines to
+     * process at the pass along @a dim+1 (sorted, without duplicates).
      */
-    void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+    void updateLines( const Dimension dim,
+                      const std::vector<Point> &lines,
+                      std::vector<Point> &nextLines );
+
+    /**
+     * Processes again the whole pass along dimension @a dim from the
+     * map of the previous pass (or from the predicate if @a dim is
+     * 0).
+     *
+     * @param [in] dim the dimension to process.
+     */
+    void recomputePass( const Dimension dim );
     
     // ------------------- protected methods ------------------------
   protected:
@@ -317,6 +440,13 @@ namespace DGtal
     ///Voronoi map image
     CountedPtr<OutputImage> myImagePtr;
 
+    ///Maps after the dimension passes 0 to d-2 (only if updates
+    ///have been requested)
+    std::vector< CountedPtr<OutputImage> > myPartialMapPtrs;
+
+    ///True if the partial maps are up-to-date for updates
+    bool myIsUpdatable;
+
   }; // end of class VoronoiMap
 
   /**
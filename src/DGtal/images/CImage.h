@@ -90,7 +90,7 @@ namespace DGtal
 ### Invariants
 
 ### Models
-  ImageContainerBySTLVector, ImageContainerBySTLMap, ImageContainerByITKImage, ImageContainerByHashTree
+  ImageContainerBySTLVector, ImageContainerBySTLMap, ImageContainerByITKImage, ImageContainerByHashTree, ImageContainerByMappedFile, ImageContainerByBricks, ImageContainerBySparseBlocks
  
 
 ### Notes
@@ -75,14 +75,14 @@ Description of \b concept '\b CImageCacheReadPolicy' <p>
 |---------------------|-------------------------|----------------------|-------------------|--------------------------------------|------------------------------------------------------|----------------|------------|
 | Get page            | x.getPage(p)            | p of type Point      | ImageContainer    | p should be in a domain of the cache | get the alias on the image that contains the point p |                |            |
 | Get page            | x.getPage(d)            | d of type Domain     | ImageContainer    | d should be in a domain of the cache | get the alias on the image that matchs the domain d  |                |            |
-| Get page to detach  | x.getPageToDetach()     |                      | ImageContainer    |                                      | get the alias on the image that we have to detach    |                |            |
+| Get page to detach  | x.getPageToDetach()     |                      | ImageContainer    |                                      | get the alias on the image that we have to detach (called until NULL before an update) |                |            |
 | Update cache        | x.updateCache(d)        | d of type Domain     |                   |                                      | update the cache with a new Domain d                 |                |            |
 | Clear cache         | x.clearCache()          |                      |                   |                                      | clear the cache                                      |                |            |
 
 ### Invariants
 
 ### Models
-ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO
+ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO, ImageCacheReadPolicyLRU, ImageCacheReadPolicyNEIGHBORS
 
 ### Notes
 
@@ -0,0 +1,391 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrentTiledImage.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ConcurrentTiledImage.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConcurrentTiledImage_RECURSES)
+#error Recursive header files inclusion detected in ConcurrentTiledImage.h
+#else // defined(ConcurrentTiledImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrentTiledImage_RECURSES
+
+#if !defined ConcurrentTiledImage_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrentTiledImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/images/CImageFactory.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ConcurrentTiledImage
+  /**
+   * Description of template class 'ConcurrentTiledImage' <p>
+   * \brief Aim: implements a tiled image from a "bigger/original" one
+   * from an ImageFactory, which can be read and written from several
+   * threads at the same time.
+   *
+   * The image is cut into tiles as TiledImage does (N tiles for each
+   * dimension). Contrary to TiledImage, whose cache is shared through
+   * aliases without any locking, the tiles are held by a cache split
+   * into shards: a tile belongs to the shard given by its index, and
+   * each shard has its own pages (replaced with a 'LRU' rule), its own
+   * counters and its own lock. Threads accessing tiles of different
+   * shards never wait for each other.
+   *
+   * The factory (e.g. ImageFactoryFromImage, ImageFactoryFromHDF5)
+   * is not assumed to be thread-safe: its calls are serialized by a
+   * dedicated lock.
+   *
+   * Writes follow a 'WB (Write-back)' policy: a modified tile which
+   * is replaced is not written by the thread replacing it but queued
+   * in its shard. The queued tiles are written to the factory by
+   * prefetch() and flush(), i.e. on the I/O side, out of the lock of
+   * their shard. A thread requesting a queued tile takes it back from
+   * the queue, and waits for the end of the write if the tile is
+   * being written. The remaining modified tiles are flushed by
+   * flush() and by the destructor.
+   *
+   * Tiles can be loaded ahead of time with prefetch(), e.g. by a
+   * thread dedicated to I/O (an OpenMP section) while the other ones
+   * process the tiles already loaded. Since the queued tiles stay in
+   * memory until then, a long computation should call prefetch() or
+   * flush() from time to time.
+   *
+   * Without WITH_OPENMP, locks are not used and the class behaves as
+   * a TiledImage with a 'LRU' read policy and a 'WB' write policy.
+   *
+   * @note This class provides point access only (it is not a model of
+   * CImage, there are no ranges).
+   *
+   * @tparam TImageFactory an image factory type (model of CImageFactory).
+   */
+  template <typename TImageFactory>
+  class ConcurrentTiledImage
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ConcurrentTiledImage<TImageFactory> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImageFactory<TImageFactory> ));
+
+    ///Types
+    typedef TImageFactory ImageFactory;
+    typedef typename ImageFactory::OutputImage OutputImage;
+    typedef typename OutputImage::Domain Domain;
+    typedef typename OutputImage::Point Point;
+    typedef typename OutputImage::Value Value;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory (see ImageFactoryFromImage or ImageFactoryFromHDF5).
+     * @param N how many tiles we want for each dimension.
+     * @param aCacheSize the maximal number of tiles in memory (split among the shards).
+     * @param aNbShards the number of shards of the cache.
+     */
+    ConcurrentTiledImage(Alias<ImageFactory> anImageFactory,
+                         typename Domain::Integer N,
+                         unsigned int aCacheSize,
+                         unsigned int aNbShards = 16);
+
+    /**
+     * Destructor.
+     * Flushes the modified tiles and detaches all the tiles.
+     */
+    ~ConcurrentTiledImage();
+
+  private:
+
+    ConcurrentTiledImage( const ConcurrentTiledImage & other );
+
+    ConcurrentTiledImage & operator=( const ConcurrentTiledImage & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains ///////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImageFactory->domain();
+    }
+
+    /**
+     * Get the domain of the tile containing aPoint.
+     *
+     * @param aPoint the point.
+     * @return the domain containing aPoint.
+     */
+    Domain findSubDomain(const Point & aPoint) const;
+
+    /////////////////// API //////////////////
+
+    /**
+     * Get the value of the image at aPoint (thread-safe).
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()(const Point & aPoint) const;
+
+    /**
+     * Set a value of the image at aPoint (thread-safe).
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue(const Point & aPoint, const Value & aValue);
+
+    /**
+     * Loads the tiles intersecting aDomain which are not in memory
+     * and writes the queued modified tiles back to the factory
+     * (thread-safe). The loaded tiles replace the least recently used
+     * ones, so aDomain should not cover more tiles than the cache size.
+     *
+     * @param aDomain a domain included in the image domain.
+     * @return the number of loaded tiles.
+     */
+    unsigned int prefetch(const Domain & aDomain);
+
+    /**
+     * Flushes all the modified tiles, in memory or queued, to the
+     * factory (thread-safe).
+     */
+    void flush();
+
+    /**
+     * Get the cacheHitRead value (sum over the shards).
+     */
+    unsigned int getCacheHitRead() const;
+
+    /**
+     * Get the cacheMissRead value (sum over the shards).
+     */
+    unsigned int getCacheMissRead() const;
+
+    /**
+     * Get the cacheHitWrite value (sum over the shards).
+     */
+    unsigned int getCacheHitWrite() const;
+
+    /**
+     * Get the cacheMissWrite value (sum over the shards).
+     */
+    unsigned int getCacheMissWrite() const;
+
+    /**
+     * Get the number of tiles flushed to the factory.
+     */
+    unsigned int getNbFlushed() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private types --------------------------------
+  private:
+
+    typedef std::list<std::size_t> LRUList;
+
+    /// A tile in memory.
+    struct Page
+    {
+      OutputImage * image;
+      bool isModified;
+      typename LRUList::iterator lruIt;
+    };
+
+    typedef std::map<std::size_t, Page> PageMap;
+    typedef std::map<std::size_t, OutputImage *> ReplacedMap;
+    typedef std::vector< std::pair<std::size_t, OutputImage *> > PageList;
+
+    /// A shard of the cache.
+    struct Shard
+    {
+      /// Tiles in memory, by tile index
+      PageMap pages;
+      /// Tile indices, the most recently used first
+      LRUList lru;
+      /// Tiles replaced while modified, waiting for the write-back
+      ReplacedMap toFlush;
+      /// Tiles being flushed (out of the shard lock)
+      std::set<std::size_t> inFlight;
+      /// Counters
+      unsigned int hitRead, missRead, hitWrite, missWrite;
+#ifdef WITH_OPENMP
+      omp_lock_t lock;
+#endif
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// ImageFactory pointer
+    ImageFactory * myImageFactory;
+
+    /// Number of tiles per dimension
+    typename Domain::Integer myN;
+
+    /// Width of a tile (for each dimension)
+    Point mySize;
+
+    /// Number of tiles along each dimension
+    Point myNbTiles;
+
+    /// domain lower and upper bound
+    Point myLowerBound, myUpperBound;
+
+    /// Maximal number of tiles in a shard
+    unsigned int myShardSize;
+
+    /// Number of shards
+    unsigned int myNbShards;
+
+    /// Shards of the cache
+    Shard * myShards;
+
+    /// Number of flushed tiles
+    mutable unsigned int myNbFlushed;
+
+#ifdef WITH_OPENMP
+    /// Lock of the factory
+    mutable omp_lock_t myFactoryLock;
+#endif
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the index of the tile containing aPoint.
+     */
+    std::size_t tileIndex(const Point & aPoint) const;
+
+    /**
+     * @return the domain of the tile of index anIndex.
+     */
+    Domain tileDomain(std::size_t anIndex) const;
+
+    /**
+     * Returns the page of a tile, taking it back from the write-back
+     * queue or loading it if necessary, the lock of the shard being
+     * held. The lock may be released and taken again while the tile
+     * is being flushed by another thread.
+     *
+     * @param aShard the shard of the tile.
+     * @param anIndex the tile index.
+     * @param isHit (returns) 'true' if the tile was in memory.
+     * @return the page.
+     */
+    Page & getPage(Shard & aShard, std::size_t anIndex, bool & isHit) const;
+
+    /**
+     * Inserts a tile in a shard as its most recently used page, the
+     * lock of the shard being held. The least recently used pages are
+     * replaced if the shard is full, the modified ones being queued
+     * for the write-back.
+     *
+     * @param aShard the shard of the tile.
+     * @param anIndex the tile index.
+     * @param anImage the image of the tile.
+     * @return the page (its 'isModified' flag is left to the caller).
+     */
+    Page & insertPage(Shard & aShard, std::size_t anIndex, OutputImage * anImage) const;
+
+    /**
+     * Flushes and detaches the tiles queued for the write-back in a
+     * shard, the lock of the shard being not held.
+     *
+     * @param aShard the shard.
+     */
+    void flushReplaced(Shard & aShard) const;
+
+    void lockShard(Shard & aShard) const;
+    void unlockShard(Shard & aShard) const;
+    void lockFactory() const;
+    void unlockFactory() const;
+
+  }; // end of class ConcurrentTiledImage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConcurrentTiledImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConcurrentTiledImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageFactory>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConcurrentTiledImage<TImageFactory> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConcurrentTiledImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConcurrentTiledImage_h
+
+#undef ConcurrentTiledImage_RECURSES
+#endif // else defined(ConcurrentTiledImage_RECURSES)
@@ -244,6 +244,24 @@ public:
         return myImagePtr;
     }
 
+    /**
+     * Returns the functor that transforms the domain.
+     * @return a const reference on the domain functor.
+     */
+    const TFunctorD & getDomainFunctor() const
+    {
+        return *myFD;
+    }
+
+    /**
+     * Returns the functor that transforms the values.
+     * @return a const reference on the value functor.
+     */
+    const TFunctorV & getValueFunctor() const
+    {
+        return *myFV;
+    }
+
     // ------------------------- Protected Datas ------------------------------
 private:
     /**
@@ -116,6 +116,8 @@ public:
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
     }
     
     /**
@@ -191,7 +193,9 @@ public:
     bool write(const Point & aPoint, const Value &aValue);
     
     /**
-     * Update the cache according to the read cache policy.
+     * Update the cache according to the read cache policy: the pages
+     * given by the read policy getPageToDetach (until it returns NULL)
+     * are flushed and detached, then the read policy loads the page(s).
      * 
      * @param aDomain the domain.
      */
@@ -213,6 +217,22 @@ public:
         return cacheMissWrite;
     }
     
+    /**
+     * Get the cacheHitRead value.
+     */
+    unsigned int getCacheHitRead()
+    {
+        return cacheHitRead;
+    }
+    
+    /**
+     * Get the cacheHitWrite value.
+     */
+    unsigned int getCacheHitWrite()
+    {
+        return cacheHitWrite;
+    }
+    
     /**
      * Inc the cacheMissRead value.
      */
@@ -230,7 +250,23 @@ public:
     }
     
     /**
-     * Clear the cache and reset the cache misses
+     * Inc the cacheHitRead value.
+     */
+    void incCacheHitRead()
+    {
+        cacheHitRead++;
+    }
+    
+    /**
+     * Inc the cacheHitWrite value.
+     */
+    void incCacheHitWrite()
+    {
+        cacheHitWrite++;
+    }
+    
+    /**
+     * Clear the cache and reset the cache misses (and hits)
      */
     void clearCacheAndResetCacheMisses()
     {
@@ -238,6 +274,8 @@ public:
       
       cacheMissRead = 0;
       cacheMissWrite = 0;
+      cacheHitRead = 0;
+      cacheHitWrite = 0;
     }
 
     // ------------------------- Protected Datas ------------------------------
@@ -262,6 +300,10 @@ private:
     /// cache miss values
     unsigned int cacheMissRead;
     unsigned int cacheMissWrite;
+    
+    /// cache hit values
+    unsigned int cacheHitRead;
+    unsigned int cacheHitWrite;
 
     // ------------------------- Internals ------------------------------------
 private:
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <deque>
+#include <list>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -266,6 +268,270 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU (Least Recently Used)' read policy cache.
+ * 
+ * The cache keeps track of all the pages in memory in a list ordered by last access, 
+ * each access to a page (with getPage) moving it to the front of the list.
+ * When a page needs to be replaced, the page at the back of the list (the least recently used page) is selected.
+ * 
+ * Contrary to the 'FIFO' policy, a page which is often accessed stays in the cache
+ * whatever its arrival date, which suits sweeps that come back to the same tiles.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory, int aLRUSizeMax=10):
+       myLRUSizeMax(aLRUSizeMax), myImageFactory(&anImageFactory)
+    {
+      ASSERT(aLRUSizeMax > 0);
+    }
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+    
+private:
+    
+    ImageCacheReadPolicyLRU( const ImageCacheReadPolicyLRU & other );
+    
+    ImageCacheReadPolicyLRU & operator=( const ImageCacheReadPolicyLRU & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * The image becomes the most recently used one.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * The image becomes the most recently used one.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+protected:
+    
+    /// Alias on the images cache, the most recently used first
+    std::list <ImageContainer *> myLRUCacheImages;
+    
+    /// Size max of the LRU
+    unsigned int myLRUSizeMax;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyLRU
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyNEIGHBORS
+/**
+ * Description of template class 'ImageCacheReadPolicyNEIGHBORS' <p>
+ * \brief Aim: implements a 'NEIGHBORS' read policy cache, i.e. a 'LRU'
+ * read policy cache which prefetches the neighbor pages.
+ * 
+ * The pages are the tiles of a regular tiling of the factory domain
+ * with N tiles for each dimension, as in TiledImage. When a page is
+ * loaded, its 2*dimension neighbor tiles (sharing a face with it)
+ * are loaded too if they are not already in the cache, so that a
+ * sweep over the image does not miss when it crosses a tile border.
+ * 
+ * The pages are replaced with the 'LRU' rule. Enough pages are
+ * detached before an update to make room for a page and all its
+ * neighbors, so the size max of the cache must be greater than
+ * 2*dimension.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 5 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains a point or NULL if no image in the cache contains that point
+ *  - getPage :                 for getting the alias on the image that contains a domain or NULL if no image in the cache contains that domain
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - updateCache :             for updating the cache according to the cache policy
+ *  - clearCache :              for clearing the cache
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyNEIGHBORS
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param N how many tiles for each dimension (the same value as the TiledImage one).
+     * @param aSizeMax size max of the cache (greater than 2*dimension).
+     */
+    ImageCacheReadPolicyNEIGHBORS(Alias<ImageFactory> anImageFactory, typename Domain::Integer N, int aSizeMax=4*Domain::dimension);
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyNEIGHBORS() {}
+    
+private:
+    
+    ImageCacheReadPolicyNEIGHBORS( const ImageCacheReadPolicyNEIGHBORS & other );
+    
+    ImageCacheReadPolicyNEIGHBORS & operator=( const ImageCacheReadPolicyNEIGHBORS & other );
+    
+public:
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * The image becomes the most recently used one.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that matchs the domain aDomain
+     * or NULL if no image in the cache matchs the domain aDomain.
+     * The image becomes the most recently used one.
+     * 
+     * @param aDomain the domain.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Domain & aDomain);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Update the cache according to the cache policy: loads the
+     * page of domain aDomain and prefetches its neighbors.
+     *
+     * @param aDomain the domain.
+     */
+    void updateCache(const Domain &aDomain);
+    
+    /**
+     * Clear the cache.
+     */
+    void clearCache();
+    
+    /**
+     * @return the number of pages loaded ahead of time since the
+     * last clearCache.
+     */
+    unsigned int getNbPrefetched() const
+    {
+      return myNbPrefetched;
+    }
+    
+protected:
+    
+    /**
+     * Loads the page of block coords aCoord if it exists and if it
+     * is not already in the cache.
+     *
+     * @param aCoord the block coords.
+     */
+    void prefetch(const Point & aCoord);
+    
+    /// Alias on the images cache, the most recently used first
+    std::list <ImageContainer *> myLRUCacheImages;
+    
+    /// Size max of the cache
+    unsigned int mySizeMax;
+    
+    /// Width of a tile (for each dimension)
+    Point mySize;
+    
+    /// Factory domain lower and upper bound
+    Point myLowerBound, myUpperBound;
+    
+    /// Number of prefetched pages
+    unsigned int myNbPrefetched;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyNEIGHBORS
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
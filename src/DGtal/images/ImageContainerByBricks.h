@@ -0,0 +1,511 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBricks.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerByBricks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBricks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBricks.h
+#else // defined(ImageContainerByBricks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBricks_RECURSES
+
+#if !defined ImageContainerByBricks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBricks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/Morton.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByBricks
+
+  /**
+   * Description of class 'ImageContainerByBricks' <p>
+   *
+   * Aim: Model of CImage implementing the association Point<->Value
+   * using a STL vector in which the values are stored by bricks.
+   *
+   * The domain is cut into bricks of \f$ 2^L \f$ points along each
+   * axis (e.g. \f$ 8^3 \f$ points in 3D for L = 3). The values of a
+   * brick are contiguous, and the bricks are ordered along a Morton
+   * (Z-order) curve of their coordinates (see Morton). Contrary to
+   * ImageContainerBySTLVector, in which the neighbors along the
+   * slowest axis are far away in memory, the neighbors of a point
+   * (e.g. for 26-neighborhood stencils or convolution kernels) are
+   * then mostly in the same brick or in a nearby one.
+   *
+   * A Morton curve covers a power of two bricks along each axis, so
+   * the curve is cut into blocks of \f$ 2^M \f$ bricks along each axis
+   * (stored in row-major order), M being the largest value (at most
+   * 4) for which the bricks added to fill the blocks are less than
+   * 1/8 of the bricks of the domain. The position of a point is then
+   * the sum of one precomputed term per axis, as fast to compute as
+   * the linearization of ImageContainerBySTLVector.
+   *
+   * As ImageContainerBySTLMap, the ranges of values follow the domain
+   * order (through operator() and setValue). A fast span iterator
+   * for 1D scans, which moves within a brick without computing the
+   * position of the points, is also provided.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel.
+   * @tparam L the logarithm (base 2) of the brick width (default 3).
+   *
+   * @see testImageContainerByBricks.cpp
+   * @see benchmarkImageContainer.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int L = 3>
+  class ImageContainerByBricks
+  {
+
+  public:
+
+    typedef ImageContainerByBricks<TDomain, TValue, L> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( CLabel<TValue> ) );
+    typedef TValue Value;
+
+    /// Brick width (number of points along each axis)
+    BOOST_STATIC_CONSTANT( Integer, brickWidth = 1 << L );
+
+    /// Brick size (number of points)
+    BOOST_STATIC_CONSTANT( Size, brickSize = static_cast<Size>( 1 ) << ( L * dimension ) );
+
+    /////////////////////////// Ranges  /////////////////////
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a Domain
+     *
+     * @param aDomain the image domain.
+     */
+    ImageContainerByBricks ( const Domain &aDomain );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBricks();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * Translate the underlying domain by @a aShift
+     * @param aShift any vector
+     */
+    void translateDomain ( const Vector& aShift );
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    Range range();
+
+    /**
+     * @return the number of stored bricks (padding included).
+     */
+    Size nbBricks() const;
+
+    /**
+     * @return the number of bricks along each axis of a block
+     * ordered along the Morton curve.
+     */
+    Size mortonBlockWidth() const;
+
+    /**
+     * @return the number of stored values (padding included).
+     */
+    Size size() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    // ------------- realization CDrawableWithBoard2D --------------------
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////////////// Custom Iterator ///////////////
+    /**
+     * Specific SpanIterator on ImageContainerByBricks: within a
+     * brick, the next value along the iterated dimension is at a
+     * constant shift, the position is computed again when the
+     * iterator enters another brick.
+     */
+    class SpanIterator
+    {
+
+      friend class ImageContainerByBricks<Domain, Value, L>;
+
+    public:
+
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef Value* pointer;
+      typedef Value& reference;
+
+      /**
+       * Constructor.
+       *
+       * @param p starting point of the SpanIterator
+       * @param aDim specifies the dimension along which the iterator will iterate
+       * @param aMap pointer to the imageContainer
+       */
+      SpanIterator ( const Point & p ,
+                     const Dimension aDim ,
+                     ImageContainerByBricks<Domain, Value, L> *aMap ) :
+        myPoint ( p ), myMap ( aMap ), myDimension ( aDim ),
+        myShift ( static_cast<Size>( 1 ) << ( L * aDim ) )
+      {
+        myPos = aMap->domain().isInside( p ) ? aMap->linearized( p ) : 0;
+      }
+
+      /**
+       * Set a value at a SpanIterator position.
+       *
+       * @param aVal the value to set.
+       */
+      inline
+      void setValue ( const Value aVal )
+      {
+        myMap->myValues[ myPos ] = aVal;
+      }
+
+      /**
+       * operator* on SpanIterators.
+       *
+       * @return the value associated to the current position.
+       */
+      inline
+      const Value & operator*()
+      {
+        return myMap->myValues[ myPos ];
+      }
+
+      /**
+       * Operator ==.
+       *
+       * @return true if this and it are equals.
+       */
+      inline
+      bool operator== ( const SpanIterator &it ) const
+      {
+        return ( myPoint[ myDimension ] == it.myPoint[ myDimension ] );
+      }
+
+      /**
+       * Operator !=
+       *
+       * @return true if this and it are different.
+       */
+      inline
+      bool operator!= ( const SpanIterator &it ) const
+      {
+        return ( myPoint[ myDimension ] != it.myPoint[ myDimension ] );
+      }
+
+      /**
+       * Implements the next() method: we move on step forward.
+       *
+       **/
+      inline
+      void next()
+      {
+        ++myPoint[ myDimension ];
+        if ( ( ( myPoint[ myDimension ] - myMap->myDomain.lowerBound()[ myDimension ] )
+               & ( brickWidth - 1 ) ) != 0 )
+          myPos += myShift;
+        else if ( myPoint[ myDimension ] <= myMap->myDomain.upperBound()[ myDimension ] )
+          myPos = myMap->linearized( myPoint );
+      }
+
+      /**
+       * Implements the prev() method: we move on step backward.
+       *
+       **/
+      inline
+      void prev()
+      {
+        ASSERT ( myPoint[ myDimension ] > myMap->myDomain.lowerBound()[ myDimension ] );
+        const bool wasInside = ( myPoint[ myDimension ] <= myMap->myDomain.upperBound()[ myDimension ] );
+        --myPoint[ myDimension ];
+        if ( wasInside
+             && ( ( ( myPoint[ myDimension ] - myMap->myDomain.lowerBound()[ myDimension ] )
+                    & ( brickWidth - 1 ) ) != ( brickWidth - 1 ) ) )
+          myPos -= myShift;
+        else
+          myPos = myMap->linearized( myPoint );
+      }
+
+      /**
+       * Operator ++ (++it)
+       *
+       */
+      inline
+      SpanIterator &operator++()
+      {
+        this->next();
+        return *this;
+      }
+
+      /**
+       * Operator ++ (it++)
+       *
+       */
+      inline
+      SpanIterator operator++ ( int )
+      {
+        SpanIterator tmp = *this;
+        ++*this;
+        return tmp;
+      }
+
+      /**
+       * Operator -- (--it)
+       *
+       */
+      inline
+      SpanIterator &operator--()
+      {
+        this->prev();
+        return *this;
+      }
+
+      /**
+       * Operator -- (it--)
+       *
+       */
+      inline
+      SpanIterator operator-- ( int )
+      {
+        SpanIterator tmp = *this;
+        --*this;
+        return tmp;
+      }
+
+    private:
+      ///Current Point in the domain
+      Point myPoint;
+
+      ///Current position in the values
+      Size myPos;
+
+      /// Pointer to the underlying image
+      ImageContainerByBricks<Domain, Value, L> *myMap;
+
+      ///Dimension on which the iterator must iterate
+      Dimension myDimension;
+
+      ///Shift between two consecutive values of a brick
+      Size myShift;
+
+    };
+
+    /**
+     * Set a value on an Image at a position specified by an SpanIterator.
+     *
+     * @param it  iterator on the location.
+     * @param aValue the value.
+     */
+    void setValue ( SpanIterator &it, const Value &aValue )
+    {
+      it.setValue ( aValue );
+    }
+
+    /**
+     * Create a begin() SpanIterator at a given position in a given
+     * direction.
+     *
+     * @param aPoint the starting point of the SpanIterator.
+     * @param aDimension the dimension on which the iterator iterates.
+     *
+     * @return a SpanIterator
+     */
+    SpanIterator spanBegin ( const Point &aPoint, const Dimension aDimension )
+    {
+      return SpanIterator ( aPoint, aDimension, this );
+    }
+
+    /**
+     * Create an end() SpanIterator at a given position in a given
+     * direction.
+     *
+     * @param aPoint a point belonging to the current image dimension (not
+     * necessarily the point used in the span_begin() method.
+     * @param aDimension the dimension on which the iterator iterates.
+     *
+     * @return a SpanIterator
+     */
+    SpanIterator spanEnd ( const Point &aPoint, const Dimension aDimension )
+    {
+      Point tmp = aPoint;
+      tmp[ aDimension ] = myDomain.upperBound() [ aDimension ] + 1;
+      return SpanIterator ( tmp, aDimension, this );
+    }
+
+    /**
+     * Returns the value of the image at a given SpanIterator position.
+     *
+     * @param it position given by a SpanIterator.
+     * @return an object of type Value.
+     */
+    Value getValue ( SpanIterator &it )
+    {
+      return ( *it );
+    }
+
+    /**
+     * Position of the value of a point in the container.
+     * @param aPoint the point to convert to an index
+     * @return the index of @a aPoint in the container
+     */
+    Size linearized ( const Point &aPoint ) const;
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Logarithm (base 2) of the number of bricks along each axis of a Morton block
+    unsigned int myMortonLevels;
+
+    ///Term of the position of a point for each axis (by coordinate)
+    std::vector<Size> myAxisPositions[ dimension ];
+
+    ///Values, brick by brick
+    std::vector<Value> myValues;
+
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBricks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBricks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int L>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByBricks<TDomain, TValue, L> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageContainerByBricks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBricks_h
+
+#undef ImageContainerByBricks_RECURSES
+#endif // else defined(ImageContainerByBricks_RECURSES)
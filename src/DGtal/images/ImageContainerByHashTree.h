@@ -42,6 +42,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -60,8 +62,6 @@
 
 namespace DGtal
 {
-  namespace experimental
-  {
   /////////////////////////////////////////////////////////////////////////////
   // template class ImageContainerByHashTree
   /**
@@ -82,6 +82,23 @@ namespace DGtal
    * The data can be accessed using keys, coordinates or Iterators
    * provided by the container.
    *
+   * The nodes (pairs key/value) are stored in a flat hash table with
+   * open addressing (linear probing), indexed by a multiplicative hash
+   * of the Morton key. The table is doubled when it is half full, so
+   * that the initial hash key size only changes the number of
+   * rehashings. A LookupCache owned by the caller keeps the bounding
+   * box and the position in the table of the last leaf found from a
+   * point (see get(const Point&, LookupCache&)), so that spatially
+   * coherent queries do not compute Morton keys nor browse the
+   * table. The read methods do not modify the image, so concurrent
+   * reads (e.g. in an OpenMP parallel loop) are allowed as long as
+   * the image is not modified and each thread uses its own
+   * LookupCache.
+   *
+   * The tree can be built in one pass from a range of points (see the
+   * constructor from a range of points) and its leaves can be visited
+   * as blocks of points (see forEachLeaf()).
+   *
    * The parent of a given key can be found by simply shifting to the
    * left the key's bits by it's dimension.  exemples: for an octree
    * (N = 3) the parent key of the key 1110100001 is 1110100.  for a
@@ -128,10 +145,6 @@ namespace DGtal
   class ImageContainerByHashTree
   {
 
-  protected:
-    class Node;
-
-
   public:
 
     typedef ImageContainerByHashTree<TDomain, TValue, THashKey> Self;
@@ -176,11 +189,9 @@ namespace DGtal
      * The constructor from a \a hashKeySize, a @a depth and a
      * @a defaultValue.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Number of bits of the initial hash
+     * table index: a value K creates a table of length 2^K, which is
+     * doubled each time it is half full.
      *
      * @param depth Determines the maximum depth of the tree and thus
      * qthe "size" of the image. Each span then extends from 0 to
@@ -199,11 +210,9 @@ namespace DGtal
      * of the tree is given by the logarithm of the domain size
      * defined by the two points.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Number of bits of the initial hash
+     * table index: a value K creates a table of length 2^K, which is
+     * doubled each time it is half full.
      *
      * @param p1 First point of the image bounding box.
      * @param p2 Second point of the image bounding box.
@@ -223,11 +232,9 @@ namespace DGtal
      * defined by the two points.
      *
      * @param aDomain the image domain
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here (default: 3).
+     * @param hashKeySize Number of bits of the initial hash
+     * table index: a value K creates a table of length 2^K, which is
+     * doubled each time it is half full (default: 3).
      *
      * @param defaultValue In order for the tree to be valid it needs
      * a default value at the root (key = 1)
@@ -237,27 +244,30 @@ namespace DGtal
                              const Value defaultValue= NumberTraits<Value>::ZERO);
 
 
-    // TODO
-    // /**
-    //  * Copy contructor.
-    //  *
-    //  * @param other object to copy.
-    //  */
-    // ImageContainerByHashTree(const ImageContainerByHashTree<Domain, Value>& other);
-
-    // /**
-    //  * Assignment.
-    //  *
-    //  * @param other object to copy.
-    //  */
-    // ImageContainerByHashTree(const ImageContainerByHashTree<Domain, Value>& other);
-
-    // /**
-    //  * Destructor
-    //  * Free the memory allocated by @a myData
-    //  */
-    // ~ImageContainerByHashTree();
-
+    /**
+     * Constructor from a @a domain and a range of points of this
+     * domain, which get the value @a aValue, the other points getting
+     * the value @a defaultValue. The tree is built bottom-up (the
+     * full blocks of points are merged level by level) instead of
+     * inserting the points one by one. The points are sorted by Morton
+     * keys first, which is cheaper when they are already in this
+     * order.
+     *
+     * @tparam TInputIterator a model of input iterator on points.
+     * @param aDomain the image domain
+     * @param itb begin iterator on the points.
+     * @param ite end iterator on the points.
+     * @param aValue the value of the points of the range.
+     * @param hashKeySize Number of bits of the initial hash
+     * table index (default: 3).
+     * @param defaultValue the value of the other points.
+     */
+    template <typename TInputIterator>
+    ImageContainerByHashTree(const Domain &aDomain,
+                             TInputIterator itb, TInputIterator ite,
+                             const Value aValue,
+                             const unsigned int hashKeySize = 3,
+                             const Value defaultValue= NumberTraits<Value>::ZERO);
 
     /**
      * @return the domain associated to the image.
@@ -311,12 +321,48 @@ namespace DGtal
     Value operator()(const Point &aPoint) const;
 
     /**
-     * Returns the value at a given coordinate using upwardGet().
+     * Returns the value at a given point. The leaf is searched from
+     * the key of the point upwards.
      * @param aPoint The point
      * @return the value
      */
     Value get(const Point & aPoint) const;
 
+    /**
+     * Last leaf found from a point by get(const Point&, LookupCache&).
+     * A cache belongs to its caller and is bound to one image: it is
+     * reset when used with another image, and invalidated when nodes
+     * are added to or removed from the image (the versions are unique
+     * in the process, see newVersion()). Threads reading the
+     * same image must use distinct caches.
+     */
+    struct LookupCache
+    {
+      LookupCache(): image( 0 ), version( 0 ) {}
+      /// Image of the leaf
+      const Self * image;
+      /// First point of the leaf
+      Point lower;
+      /// Width of the leaf
+      Integer width;
+      /// Place of the leaf in the hash table
+      unsigned int place;
+      /// Version of the table when the leaf was found
+      unsigned long version;
+    };
+
+    /**
+     * Returns the value at a given point. If the point lies in the
+     * leaf stored in aCache, its value is returned without computing
+     * the key of the point. Otherwise, the leaf is searched from the
+     * key of the point upwards and stored in aCache for the next
+     * queries.
+     * @param aPoint The point
+     * @param aCache the lookup cache of the caller.
+     * @return the value
+     */
+    Value get(const Point & aPoint, LookupCache & aCache) const;
+
 
     /**
      * Returns the value corresponding to a key making the assumption
@@ -400,8 +446,6 @@ namespace DGtal
      */
     bool checkIntegrity(HashKey key = ROOT_KEY, bool leafAbove = false) const;
 
-    int myDebugCounter; //debug
-
     //stuff that might be moved out of the class for reusability
     HashKey getKey(const Point & aPoint) const;
 
@@ -443,11 +487,11 @@ namespace DGtal
      * displaying the data:
      *
      *     - Nunber of elements in the tree.
-     *     - Amount of unused disk space due to blanks in the hash table.
+     *     - Amount of unused memory due to blanks in the hash table.
      *     - The dimmension.
-     *     - The number of bits of the HashKey.
+     *     - The number of bits of the hash table index.
      *     - The size of the image.
-     *     - The average and the maximum amount of collisions.
+     *     - The average and the maximum probe lengths.
      *     - The total memory usage.
      *
      * @param out output stream.
@@ -460,21 +504,24 @@ namespace DGtal
     unsigned int getNbEmptyLists() const;
 
     /**
-     * Returns The average number of collisions in the hash table,
-     * without counting the empty places.
+     * Returns the average number of collisions in the hash table,
+     * i.e. the average distance between the place of a node and the
+     * place given by its hash.
      */
     double getAverageCollisions() const;
 
     /**
-     * Returns the highest number of collisions in the hash table.
+     * Returns the highest number of collisions in the hash table,
+     * i.e. the highest distance between the place of a node and the
+     * place given by its hash.
      */
     unsigned int getMaxCollisions() const;
 
     /**
-     * Returns the number of elements for a given key of the hash
-     * table.
+     * Returns the number of elements (0 or 1) at a given place of the
+     * hash table.
      *
-     * @param intermediateKey a hashtree key.
+     * @param intermediateKey a place in the hash table.
      */
     unsigned int getNbNodes(unsigned int intermediateKey) const;
 
@@ -488,23 +535,20 @@ namespace DGtal
     /*  Iterator inner-class
      *
      *  @brief Buil-in iterator on an HashTree. This iterator visits
-     *  all node in the tree.
+     *  all node in the tree, in the order of the hash table.
      *
      * -------------------------------------------------------------
      */
     class Iterator
     {
     public:
-      Iterator(Node** data, unsigned int position, unsigned int arraySize)
+      Iterator(std::pair<HashKey, Value>* data, unsigned int position, unsigned int arraySize)
       {
         myArraySize = arraySize;
         myContainerData = data;
-        myNode = data[0];
         myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
-          {
-            myNode = myContainerData[++myCurrentCell];
-          }
+        while ((myCurrentCell < myArraySize) && (myContainerData[myCurrentCell].first == 0))
+          ++myCurrentCell;
       }
       bool isAtEnd()const
       {
@@ -512,7 +556,7 @@ namespace DGtal
       }
       Value& operator*()
       {
-        return myNode->getObject();
+        return myContainerData[myCurrentCell].second;
       }
       bool operator ++ ()
       {
@@ -520,28 +564,21 @@ namespace DGtal
       }
       bool operator == (const Iterator& it)
       {
-        if (isAtEnd() && it.isAtEnd())
-          return true;
-        else
-          return (myNode == it.myNode);
+        return (myCurrentCell == it.myCurrentCell);
       }
       bool operator != (const Iterator& it)
       {
-        if (isAtEnd() && it.isAtEnd())
-          return false;
-        else
-          return (myNode != it.myNode);
+        return (myCurrentCell != it.myCurrentCell);
       }
       inline HashKey getKey() const
       {
-        return myNode->getKey();
+        return myContainerData[myCurrentCell].first;
       }
       bool next();
     protected:
-      Node* myNode;
       unsigned int myCurrentCell;
       unsigned int myArraySize;
-      Node** myContainerData;
+      std::pair<HashKey, Value>* myContainerData;
     };
 
     /**
@@ -549,7 +586,7 @@ namespace DGtal
      */
     Iterator begin()
     {
-      return Iterator(myData, 0, myArraySize);
+      return Iterator(&myNodes[0], 0, myArraySize);
     }
 
     /**
@@ -557,10 +594,24 @@ namespace DGtal
      */
     Iterator end()
     {
-      return Iterator(myData, myArraySize, myArraySize);
+      return Iterator(&myNodes[0], myArraySize, myArraySize);
     }
 
-    void selfDisplay(std::ostream & out);
+    /**
+     * Applies a functor on each leaf of the tree, in the order of the
+     * hash table. The functor is called with the domain of the points
+     * of the leaf (restricted to the image domain) and the value of
+     * the leaf: @a aFunctor( const Domain &, const Value & ). The
+     * leaves outside the image domain are skipped.
+     *
+     * @tparam TFunctor the type of the functor.
+     * @param aFunctor the functor.
+     * @return the functor after its calls (as std::for_each).
+     */
+    template <typename TFunctor>
+    TFunctor forEachLeaf(TFunctor aFunctor) const;
+
+    void selfDisplay(std::ostream & out) const;
 
     bool isValid() const
     {
@@ -590,126 +641,54 @@ namespace DGtal
     recursiveDraw(HashKey key, const double p1[2], const double len, Board2D & board, const C& cmap) const;
 
 
-    // -------------------------------------------------------------
     /**
-     * @class Node
+     * This is the hash function. It is called whenever a key is
+     * accessed and returns the place of the key in the hash table if
+     * there is no collision.
      *
-     * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-     * lists to handle collisions). Each element in the container is placed in a Node.
+     * @param key a node in the hashtree.
      */
-    class Node
-    {
-    public:
-
-      /**
-       * Construtctor: create pair (@a aValue, @a key)
-       *
-       * @param aValue  First value
-       * @param key     key in the hashtree
-       */
-      Node(Value aValue, HashKey key)
-      {
-        myData = aValue;
-        myKey = key;
-      }
-
-      /**
-       * @return the next pair (aValue, key) in the list.
-       */
-      inline Node* getNext()
-      {
-        return myNext;
-      }
-
-
-      /**
-       * Insert the pair (value,key)  @a next in the node list
-       *
-       * @param next a pointer to a pair (value,key) (Node).
-       */
-      inline void setNext(Node* next)
-      {
-        myNext = next;
-      }
-
-      /**
-       *
-       * @return the key associated to a Node.
-       */
-      inline HashKey getKey()
-      {
-        return myKey;
-      }
-
-      /**
-       *
-       * @return the object (aValue) associated to a Node.
-       */
-      inline Value& getObject()
-      {
-        return myData;
-      }
-      ~Node() { }
-    protected:
-      HashKey myKey;
-      Node* myNext;
-      Value myData;
-    };// -----------------------------------------------------------
-
+    inline unsigned int getIntermediateKey(const HashKey key) const;
 
     /**
-     * This is part of the hash function. It is called whenever a key
-     * is accessed.  The mask used to compute the result is
-     * precomputed in the constructor for efficiency.
-     *
-     * @param key a node in the hashtree.
+     * Returns the place of a key in the hash table, or the size of
+     * the table if the key is not in the table. This method is called
+     * VERY often, and thus should operate as fast as possible.
+     * @param key The key.
      */
-    inline HashKey getIntermediateKey(const HashKey key) const;
-
+    inline unsigned int findNode(const HashKey key) const
+    {
+      const unsigned int mask = myArraySize - 1;
+      unsigned int i = getIntermediateKey(key);
+      while (myNodes[i].first != 0)
+        {
+          if (myNodes[i].first == key)
+            return i;
+          i = (i + 1) & mask;
+        }
+      return myArraySize;
+    }
 
     /**
      * Add a Node to the tree.  This method is very used when writing
-     * in the tree (set method). As detailed in the inner class
-     * Node, nodes are pairs (value,key)
+     * in the tree (set method). Nodes are pairs (key,value).
      *
      * @param object a object (value)
      * @param key a hashtree key
-     * @return a pointer to the node list.
      */
-    Node* addNode(const Value object, const HashKey key)
-    {
-      Node* n = getNode(key);
-      if (n)
-        {
-          n->getObject() = object;
-          //n->setObject(object);
-          return n;
-        }
-      n = new Node(object, key);
-      HashKey key2 = getIntermediateKey(key);
-      n->setNext(myData[key2]);
-      myData[key2] = n;
-      return n;
-    }
+    void addNode(const Value object, const HashKey key);
 
   public:
     /**
-     * Returns a pointer to the node corresponding to the key. If it
-     * does'nt exist, returns 0.  This method is called VERY often,
-     * and thus should operate as fast as possible.
+     * Returns a pointer to the value of the node corresponding to the
+     * key. If it does'nt exist, returns 0.
      * @param key The key.
-     * @return the pointer to the node corresponding to the key.
+     * @return the pointer to the value of the node corresponding to the key.
      */
-    inline Node* getNode(const HashKey key)  const  // very used !! // public because Display2DFactory !!!
+    inline const Value* getNodeValue(const HashKey key) const // public because Display2DFactory !!!
     {
-      Node* iter = myData[getIntermediateKey(key)];
-      while (iter != 0)
-        {
-          if (iter->getKey() == key)
-            return iter;
-          iter = iter->getNext();
-        }
-      return 0;
+      const unsigned int i = findNode(key);
+      return (i != myArraySize) ? &myNodes[i].second : 0;
     }
   protected:
 
@@ -728,6 +707,38 @@ namespace DGtal
     void recursiveRemoveNode(HashKey key, unsigned int nbRecursions);
 
 
+    /**
+     * Resizes the hash table and inserts again all the nodes.
+     * @param hashKeySize the number of bits of the new table index.
+     */
+    void rehash(unsigned int hashKeySize);
+
+    /**
+     * Creates an empty hash table.
+     * @param hashKeySize the number of bits of the table index.
+     */
+    void initTable(unsigned int hashKeySize);
+
+    /**
+     * Returns a version number that was never returned before in the
+     * process, so that a lookup cache filled by an image is never
+     * valid for another one, even allocated at the same address.
+     */
+    static unsigned long newVersion();
+
+    /**
+     * Set the depth of the tree from the image domain, so that the
+     * tree covers the domain.
+     */
+    void setDepthFromDomain();
+
+    /**
+     * @return the first point of a key (at any depth), relatively to
+     * the origin of the tree.
+     * @param key the key.
+     */
+    Point getPointFromKey(HashKey key) const;
+
     /**
      * Set the (maximum) depth of the tree and precompute a mask used
      * for some calculations.  The depth of the tree must be known
@@ -754,19 +765,29 @@ namespace DGtal
     Domain myDomain;
 
     /**
-     * The array of linked lists containing all the data
+     * The hash table containing all the nodes (key,value), an empty
+     * place having the key 0.
      */
-    Node** myData;
+    std::vector< std::pair<HashKey, Value> > myNodes;
 
     /**
-     * The size of the intermediate hashkey. The bigger the less
-     * collisions, but at the same time the more chances to have
-     * unused memory allocated.
+     * The number of bits of the hash table index.
      */
     unsigned int myKeySize;
 
     unsigned int myArraySize;
 
+    /**
+     * The number of nodes in the hash table.
+     */
+    unsigned int myNbNodes;
+
+    /**
+     * Renewed (see newVersion()) each time nodes are added or
+     * removed, to invalidate the lookup caches.
+     */
+    unsigned long myVersion;
+
     /**
      * The depth of the tree
      */
@@ -787,7 +808,6 @@ namespace DGtal
      * Precoputed masks to avoid recalculating it all the time
      */
     HashKey myDepthMask;
-    HashKey myPreComputedIntermediateMask; // ~((~0) << _keySize)
 
   public:
     ///The morton code computer.
@@ -804,14 +824,18 @@ namespace DGtal
    */
   template<typename TDomain, typename TValue, typename THashKey >
   std::ostream&
-  operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey> & object )
+  operator<< ( std::ostream & out,  const ImageContainerByHashTree<TDomain, TValue, THashKey> & object )
   {
     object.selfDisplay( out);
     return out;
   }
 
+  namespace experimental
+  {
+    /// Former name of ImageContainerByHashTree.
+    using DGtal::ImageContainerByHashTree;
+  }
 
-}
 } // namespace DGtal
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,372 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerByMappedFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
+#include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByMappedFile
+
+  /**
+   * Description of class 'ImageContainerByMappedFile' <p>
+   *
+   * Aim: Model of CImage implementing the association Point<->Value
+   * on the values stored in a file, which is mapped in memory (mmap)
+   * instead of being read. Opening a large volume is then immediate,
+   * and only the pages of the file which are accessed are loaded in
+   * memory.
+   *
+   * The file stores the values of the whole domain, without padding,
+   * in the native byte order and in the same order as
+   * ImageContainerBySTLVector (first axis is the fastest one), after
+   * a header of a given size (e.g. the payload of a raw or a vol
+   * file, see RawReader::mapRaw8 and VolReader::mapVol).
+   *
+   * The file can be mapped:
+   * - read-only: the values must not be modified (setValue, range),
+   * - copy-on-write: the values can be modified, the modified pages
+   *   are copied in memory and the file is never written.
+   *
+   * The values are accessed as with ImageContainerBySTLVector
+   * (operator(), setValue, ranges, iterators on the values). Copies
+   * of a read-only container share the same mapping, which is
+   * released with the last copy. A copy of a copy-on-write container
+   * owns a copy of the values (in anonymous memory), so that the
+   * copies are modified independently.
+   *
+   * @note On systems without mmap (WIN32), the file is read in memory.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel, of a plain old data type.
+   *
+   * @see testImageContainerByMappedFile.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+
+  public:
+
+    typedef ImageContainerByMappedFile<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( CLabel<TValue> ) );
+    typedef TValue Value;
+
+    /////////////////////////// Iterators ////////////////////
+    // built-in iterators
+    typedef Value* Iterator;
+    typedef const Value* ConstIterator;
+    typedef std::reverse_iterator<Iterator> ReverseIterator;
+    typedef std::reverse_iterator<ConstIterator> ConstReverseIterator;
+    typedef std::ptrdiff_t Difference;
+
+    typedef Value* OutputIterator;
+    typedef std::reverse_iterator<Iterator> ReverseOutputIterator;
+
+    /////////////////////////// Ranges  /////////////////////
+    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator,DistanceFunctorFromPoint<Self> > ConstRange;
+    typedef SimpleRandomAccessRangeFromPoint<ConstIterator,Iterator,DistanceFunctorFromPoint<Self> > Range;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor.
+     * Maps the values of the file stored from @a anOffset.
+     *
+     * @param aFilename the file name.
+     * @param aDomain the image domain.
+     * @param isCopyOnWrite if true, the file is mapped in copy-on-write
+     * mode, otherwise it is mapped read-only.
+     * @param anOffset the position of the first value in the file (in bytes).
+     *
+     * @throw IOException if the file cannot be opened or mapped, or
+     * if it is too small for the domain.
+     */
+    ImageContainerByMappedFile ( const std::string &aFilename,
+                                 const Domain &aDomain,
+                                 const bool isCopyOnWrite = false,
+                                 const std::size_t anOffset = 0 );
+
+    /**
+     * Copy constructor.
+     * The mapping is shared with @a other if it is read-only, the
+     * values are copied otherwise.
+     *
+     * @param other the object to copy.
+     */
+    ImageContainerByMappedFile ( const ImageContainerByMappedFile & other );
+
+    /**
+     * Assignment operator.
+     * The mapping is shared with @a other if it is read-only, the
+     * values are copied otherwise.
+     *
+     * @param other the object to copy.
+     * @return a reference on *this
+     */
+    ImageContainerByMappedFile& operator= ( const ImageContainerByMappedFile & other );
+
+    /**
+     * Destructor.
+     * The file is unmapped with the last copy sharing the mapping.
+     */
+    ~ImageContainerByMappedFile();
+
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain and the file
+     * must be mapped in copy-on-write mode.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * Translate the underlying domain by @a aShift
+     * @param aShift any vector
+     */
+    void translateDomain ( const Vector& aShift );
+
+    /**
+     * @return the mapped file name.
+     */
+    const std::string & filename() const;
+
+    /**
+     * @return true if the file is mapped in copy-on-write mode.
+     */
+    bool isCopyOnWrite() const;
+
+    /**
+     * @return the number of values (which may exceed the range of
+     * Size on large domains).
+     */
+    std::size_t size() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    // ------------- realization CDrawableWithBoard2D --------------------
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /**
+     * @return an iterator on the first value.
+     * @pre the file must be mapped in copy-on-write mode.
+     */
+    Iterator begin();
+
+    /**
+     * @return an iterator after the last value.
+     */
+    Iterator end();
+
+    /**
+     * @return a constant iterator on the first value.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a constant iterator after the last value.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     * @pre the file must be mapped in copy-on-write mode to write values.
+     */
+    Range range();
+
+    /**
+     *  Linearized a point and return the vector position.
+     * @param aPoint the point to convert to an index
+     * @return the index of @a aPoint in the container
+     */
+    std::size_t linearized ( const Point &aPoint ) const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Replaces the shared values by a copy owned by this image (in
+     * anonymous memory).
+     * @throw std::bad_alloc if the memory cannot be allocated.
+     */
+    void copyValues();
+
+    // ------------------------- Private types --------------------------------
+  private:
+
+    /// A mapped region of a file (unmapped at destruction).
+    struct Mapping
+    {
+      Mapping(): address( 0 ), length( 0 ) {}
+      ~Mapping();
+
+      /// Mapped address
+      void * address;
+      /// Mapped length (in bytes)
+      std::size_t length;
+    };
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    ///Mapped file name
+    std::string myFilename;
+
+    ///Copy-on-write mode
+    bool myIsCopyOnWrite;
+
+    ///Mapping, shared by the read-only copies
+    CountedPtr<Mapping> myMapping;
+
+    ///First value
+    Value * myData;
+
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMappedFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -0,0 +1,457 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerBySparseBlocks.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerBySparseBlocks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerBySparseBlocks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerBySparseBlocks.h
+#else // defined(ImageContainerBySparseBlocks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerBySparseBlocks_RECURSES
+
+#if !defined ImageContainerBySparseBlocks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerBySparseBlocks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerBySparseBlocks
+
+  /**
+   * Description of class 'ImageContainerBySparseBlocks' <p>
+   *
+   * Aim: Model of CImage implementing the association Point<->Value
+   * for images which are mostly equal to a background value (e.g.
+   * segmentation volumes).
+   *
+   * The domain is cut into blocks of \f$ 2^L \f$ points along each
+   * axis (e.g. \f$ 8^3 \f$ points in 3D for L = 3). A dense table of
+   * pointers, one per block, gives the values of the blocks which
+   * contain a point with a value different from the background
+   * value (the active points). The values of such a block are stored
+   * densely, the other blocks are not allocated: the memory is
+   * proportional to the number of blocks containing an active point
+   * (plus one pointer per block). A block is freed as soon as its
+   * last active point gets the background value again.
+   *
+   * Reading or writing a value costs the computation of the block and
+   * of the position of the point in the block, as for
+   * ImageContainerBySTLVector, instead of a search in a std::map for
+   * ImageContainerBySTLMap. The active points can be visited without
+   * scanning the background through activeBegin() and activeEnd().
+   *
+   * As ImageContainerBySTLMap, the ranges of values follow the domain
+   * order (through operator() and setValue). This container is
+   * returned by ImageSelector for the SPARSE_I preference.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel.
+   * @tparam L the logarithm (base 2) of the block width (default 3).
+   *
+   * @see testImageContainerBySparseBlocks.cpp
+   * @see benchmarkImageContainer.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int L = 3>
+  class ImageContainerBySparseBlocks
+  {
+
+  public:
+
+    typedef ImageContainerBySparseBlocks<TDomain, TValue, L> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( CLabel<TValue> ) );
+    typedef TValue Value;
+
+    /// Block width (number of points along each axis)
+    BOOST_STATIC_CONSTANT( Integer, blockWidth = 1 << L );
+
+    /// Block size (number of points)
+    BOOST_STATIC_CONSTANT( Size, blockSize = static_cast<Size>( 1 ) << ( L * dimension ) );
+
+    /////////////////////////// Ranges  /////////////////////
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a Domain and a background value. All the
+     * points have the background value.
+     *
+     * @param aDomain the image domain.
+     * @param aBackground the background value (default 0).
+     */
+    ImageContainerBySparseBlocks ( const Domain &aDomain, const Value &aBackground = 0 );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImageContainerBySparseBlocks ( const ImageContainerBySparseBlocks &other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerBySparseBlocks & operator= ( const ImageContainerBySparseBlocks &other );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerBySparseBlocks();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     * The block of the point is allocated if @a aValue is not the
+     * background value, and freed if it only contains the background
+     * value afterwards.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * Translate the underlying domain by @a aShift
+     * @param aShift any vector
+     */
+    void translateDomain ( const Vector& aShift );
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing begin and end
+     * iterators to scan the values of image.
+     */
+    Range range();
+
+    /**
+     * @return the background value.
+     */
+    const Value & background() const;
+
+    /**
+     * @return the number of active points, i.e. the points whose
+     * value is not the background value.
+     */
+    Size nbActivePoints() const;
+
+    /**
+     * @return the number of allocated blocks.
+     */
+    Size nbAllocatedBlocks() const;
+
+    /**
+     * @return the number of blocks covering the domain.
+     */
+    Size nbBlocks() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    // ------------- realization CDrawableWithBoard2D --------------------
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////////////// Active points ///////////////
+    /**
+     * Forward iterator on the values of the active points, block by
+     * block. The point of the current value is given by point().
+     */
+    class ActiveConstIterator
+    {
+
+      friend class ImageContainerBySparseBlocks<Domain, Value, L>;
+
+    public:
+
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef const Value* pointer;
+      typedef const Value& reference;
+
+      /**
+       * Default constructor.
+       */
+      ActiveConstIterator () : myImage ( 0 ), myBlock ( 0 ), myPos ( 0 ) {}
+
+      /**
+       * @return the value of the current active point.
+       */
+      inline
+      const Value & operator*() const
+      {
+        return myImage->myBlocks[ myBlock ]->values[ myPos ];
+      }
+
+      /**
+       * @return the current active point.
+       */
+      inline
+      Point point() const
+      {
+        return myImage->pointFromIndices( myBlock, myPos );
+      }
+
+      /**
+       * Operator ++ (++it)
+       */
+      inline
+      ActiveConstIterator &operator++()
+      {
+        ++myPos;
+        skipBackground();
+        return *this;
+      }
+
+      /**
+       * Operator ++ (it++)
+       */
+      inline
+      ActiveConstIterator operator++ ( int )
+      {
+        ActiveConstIterator tmp = *this;
+        ++*this;
+        return tmp;
+      }
+
+      /**
+       * Operator ==.
+       * @return true if this and it are equals.
+       */
+      inline
+      bool operator== ( const ActiveConstIterator &it ) const
+      {
+        return ( myBlock == it.myBlock ) && ( myPos == it.myPos );
+      }
+
+      /**
+       * Operator !=
+       * @return true if this and it are different.
+       */
+      inline
+      bool operator!= ( const ActiveConstIterator &it ) const
+      {
+        return !( *this == it );
+      }
+
+    private:
+
+      /**
+       * Constructor.
+       *
+       * @param anImage the image.
+       * @param aBlock the index of the current block.
+       * @param aPos the position in the current block.
+       */
+      ActiveConstIterator ( const Self *anImage, const Size aBlock, const Size aPos ) :
+        myImage ( anImage ), myBlock ( aBlock ), myPos ( aPos )
+      {
+        skipBackground();
+      }
+
+      /**
+       * Moves to the first active point from the current position.
+       */
+      void skipBackground();
+
+      /// Pointer to the image
+      const Self *myImage;
+
+      /// Index of the current block
+      Size myBlock;
+
+      /// Position in the current block
+      Size myPos;
+
+    };
+
+    /**
+     * @return an iterator on the first active point.
+     */
+    ActiveConstIterator activeBegin() const;
+
+    /**
+     * @return an iterator after the last active point.
+     */
+    ActiveConstIterator activeEnd() const;
+
+    /////////////////// Data members //////////////////
+
+  private:
+
+    /**
+     * Values of an allocated block.
+     */
+    struct Block
+    {
+      /// Values of the points of the block
+      std::vector<Value> values;
+
+      /// Number of values different from the background value
+      Size nbActive;
+    };
+
+    /**
+     * Computes the index of the block of a point and the position of
+     * the point in this block.
+     *
+     * @param aPoint a point of the domain.
+     * @param aBlock (returns) the index of the block.
+     * @param aPos (returns) the position in the block.
+     */
+    void indices ( const Point &aPoint, Size &aBlock, Size &aPos ) const;
+
+    /**
+     * @param aBlock the index of a block.
+     * @param aPos a position in this block.
+     * @return the point at this position.
+     */
+    Point pointFromIndices ( const Size aBlock, const Size aPos ) const;
+
+    /**
+     * Frees the allocated blocks.
+     */
+    void clearBlocks();
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Background value
+    Value myBackground;
+
+    ///Number of blocks along each axis
+    Size myNbBlocks[ dimension ];
+
+    ///Pointers to the blocks (0 for the blocks which are not allocated)
+    std::vector<Block*> myBlocks;
+
+    ///Number of active points
+    Size myNbActive;
+
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerBySparseBlocks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerBySparseBlocks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int L>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerBySparseBlocks<TDomain, TValue, L> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageContainerBySparseBlocks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerBySparseBlocks_h
+
+#undef ImageContainerBySparseBlocks_RECURSES
+#endif // else defined(ImageContainerBySparseBlocks_RECURSES)
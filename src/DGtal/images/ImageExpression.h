@@ -0,0 +1,579 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageExpression.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageExpression.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageExpression_RECURSES)
+#error Recursive header files inclusion detected in ImageExpression.h
+#else // defined(ImageExpression_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageExpression_RECURSES
+
+#if !defined ImageExpression_h
+/** Prevents repeated inclusion of headers. */
+#define ImageExpression_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include <vector>
+#include <boost/scoped_array.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageSpan
+  /**
+   * Description of template class 'ImageSpan' <p>
+   * \brief Aim: reads and writes the values of an image along a span
+   * of points, i.e. the points p, p + e_0, ..., p + (n-1) e_0 of
+   * an axis-parallel line.
+   *
+   * The default implementation calls the operator() and the setValue
+   * method for each point. Images which store the values of a span
+   * contiguously (e.g. ImageContainerBySTLVector) specialize this
+   * class to copy them at once. It is also specialized for the
+   * ConstImageAdapter whose domain functor is the identity
+   * (DefaultFunctor): the span is read in the adapted image and the
+   * value functor is applied to the values of the span.
+   *
+   * @a isConcurrent is true if different spans can be read and
+   * written from several threads at the same time (false by
+   * default).
+   *
+   * @tparam TImage a model of CConstImage (CImage for write).
+   */
+  template <typename TImage>
+  struct ImageSpan
+  {
+    typedef TImage Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain::Size Size;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = false );
+
+    /**
+     * Reads the values of a span.
+     *
+     * @param anImage the image.
+     * @param aStart the first point of the span.
+     * @param aLength the number of points of the span.
+     * @param aOut (returns) the @a aLength values of the span.
+     */
+    static void read ( const Image & anImage, const Point & aStart,
+                       const Size aLength, Value * aOut );
+
+    /**
+     * Writes the values of a span.
+     *
+     * @param anImage the image.
+     * @param aStart the first point of the span.
+     * @param aLength the number of points of the span.
+     * @param aIn the @a aLength values of the span (converted to Value).
+     *
+     * @tparam TInput the type of the values to write.
+     */
+    template <typename TInput>
+    static void write ( Image & anImage, const Point & aStart,
+                        const Size aLength, const TInput * aIn );
+  };
+
+  /**
+   * Specialization of ImageSpan for ImageContainerBySTLVector: the
+   * values of a span are contiguous.
+   */
+  template <typename TDomain, typename TValue>
+  struct ImageSpan< ImageContainerBySTLVector<TDomain, TValue> >
+  {
+    typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain::Size Size;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = true );
+
+    static void read ( const Image & anImage, const Point & aStart,
+                       const Size aLength, Value * aOut );
+
+    template <typename TInput>
+    static void write ( Image & anImage, const Point & aStart,
+                        const Size aLength, const TInput * aIn );
+  };
+
+  /**
+   * Specialization of ImageSpan for ImageContainerBySTLVector on
+   * bool values: the values are packed by std::vector<bool> and
+   * accessed through its iterators. Two spans may share a word, so
+   * they are not written concurrently.
+   */
+  template <typename TDomain>
+  struct ImageSpan< ImageContainerBySTLVector<TDomain, bool> >
+  {
+    typedef ImageContainerBySTLVector<TDomain, bool> Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain::Size Size;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = false );
+
+    static void read ( const Image & anImage, const Point & aStart,
+                       const Size aLength, Value * aOut );
+
+    template <typename TInput>
+    static void write ( Image & anImage, const Point & aStart,
+                        const Size aLength, const TInput * aIn );
+  };
+
+  /**
+   * Specialization of ImageSpan for the ConstImageAdapter whose
+   * domain functor is the identity: the span is read in the adapted
+   * image and the value functor applied to its values.
+   */
+  template <typename TImageContainer, typename TNewDomain,
+            typename TNewValue, typename TFunctorV>
+  struct ImageSpan< ConstImageAdapter<TImageContainer, TNewDomain, DefaultFunctor,
+                                      TNewValue, TFunctorV> >
+  {
+    typedef ConstImageAdapter<TImageContainer, TNewDomain, DefaultFunctor,
+                              TNewValue, TFunctorV> Image;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Image::Domain::Size Size;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = ImageSpan<TImageContainer>::isConcurrent );
+
+    static void read ( const Image & anImage, const Point & aStart,
+                       const Size aLength, Value * aOut );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageExpressionBase
+  /**
+   * Description of template class 'ImageExpressionBase' <p>
+   * \brief Aim: base class (CRTP) of the nodes of an image expression.
+   *
+   * An image expression is a tree whose leaves are images
+   * (TerminalImageExpression) and whose nodes apply a functor to the
+   * values of one or two sub-expressions (UnaryImageExpression,
+   * BinaryImageExpression). The nodes are stored by value and the
+   * functors are known at compile time: the value of a point is
+   * computed by inlined calls, instead of the calls through pointers
+   * of a chain of ConstImageAdapter.
+   *
+   * Each node is a model of CConstImage and evaluates the values of a
+   * span in chunks of @a chunkSize points (evaluateSpan), the leaves
+   * reading their images with ImageSpan. An expression is
+   * materialized into an image with materialize().
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+   * Image a( domain ), b( domain ), c( domain );
+   * ...
+   * // c = 2 a + b, computed span by span
+   * materialize( transformExpression( imageExpression( a ),
+   *                                   std::bind1st( std::multiplies<double>(), 2.0 ) )
+   *              + imageExpression( b ), c );
+   * @endcode
+   *
+   * @tparam TDerived the type of the node.
+   */
+  template <typename TDerived>
+  struct ImageExpressionBase
+  {
+    /// Number of values evaluated at once by the nodes
+    BOOST_STATIC_CONSTANT( unsigned int, chunkSize = 256 );
+
+    /**
+     * @return the node as its actual type.
+     */
+    const TDerived & derived() const
+    {
+      return static_cast<const TDerived &>( *this );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class TerminalImageExpression
+  /**
+   * Description of template class 'TerminalImageExpression' <p>
+   * \brief Aim: leaf of an image expression, i.e. an alias on an
+   * image.
+   *
+   * @tparam TImage a model of CConstImage.
+   */
+  template <typename TImage>
+  class TerminalImageExpression :
+    public ImageExpressionBase< TerminalImageExpression<TImage> >
+  {
+  public:
+    typedef TerminalImageExpression<TImage> Self;
+    BOOST_CONCEPT_ASSERT(( CConstImage<TImage> ));
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Domain::Size Size;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = ImageSpan<Image>::isConcurrent );
+
+    /**
+     * Constructor.
+     * @param anImage the image (aliased).
+     */
+    TerminalImageExpression ( const Image & anImage ) : myImagePtr( &anImage ) {}
+
+    /**
+     * @return the domain of the image.
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
+
+    /**
+     * @return the range of the values of the expression.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the value at @a aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const
+    {
+      return ( *myImagePtr )( aPoint );
+    }
+
+    /**
+     * Evaluates the values of a span.
+     *
+     * @param aStart the first point of the span.
+     * @param aLength the number of points of the span.
+     * @param aOut (returns) the @a aLength values of the span.
+     */
+    void evaluateSpan ( const Point & aStart, const Size aLength, Value * aOut ) const
+    {
+      ImageSpan<Image>::read( *myImagePtr, aStart, aLength, aOut );
+    }
+
+    /**
+     * @return 'true' if the image is valid.
+     */
+    bool isValid() const
+    {
+      return myImagePtr->isValid();
+    }
+
+  private:
+    /// Alias on the image
+    const Image * myImagePtr;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class UnaryImageExpression
+  /**
+   * Description of template class 'UnaryImageExpression' <p>
+   * \brief Aim: node of an image expression which applies a functor to
+   * the values of a sub-expression.
+   *
+   * @tparam TExpression the type of the sub-expression.
+   * @tparam TFunctor a unary functor on the values of the sub-expression.
+   * @tparam TValue the type of the values returned by the functor
+   * (default: TFunctor::result_type).
+   */
+  template <typename TExpression, typename TFunctor,
+            typename TValue = typename TFunctor::result_type>
+  class UnaryImageExpression :
+    public ImageExpressionBase< UnaryImageExpression<TExpression, TFunctor, TValue> >
+  {
+  public:
+    typedef UnaryImageExpression<TExpression, TFunctor, TValue> Self;
+    typedef typename TExpression::Domain Domain;
+    typedef typename TExpression::Point Point;
+    typedef TValue Value;
+    typedef typename Domain::Size Size;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = TExpression::isConcurrent );
+
+    /**
+     * Constructor.
+     * @param anExpression the sub-expression (copied).
+     * @param aFunctor the functor (copied).
+     */
+    UnaryImageExpression ( const TExpression & anExpression, const TFunctor & aFunctor ) :
+      myExpression( anExpression ), myFunctor( aFunctor ) {}
+
+    /**
+     * @return the domain of the sub-expression.
+     */
+    const Domain & domain() const
+    {
+      return myExpression.domain();
+    }
+
+    /**
+     * @return the range of the values of the expression.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the value at @a aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const
+    {
+      return myFunctor( myExpression( aPoint ) );
+    }
+
+    /**
+     * Evaluates the values of a span.
+     *
+     * @param aStart the first point of the span.
+     * @param aLength the number of points of the span.
+     * @param aOut (returns) the @a aLength values of the span.
+     */
+    void evaluateSpan ( const Point & aStart, const Size aLength, Value * aOut ) const;
+
+    /**
+     * @return 'true' if the sub-expression is valid.
+     */
+    bool isValid() const
+    {
+      return myExpression.isValid();
+    }
+
+  private:
+    /// Sub-expression
+    TExpression myExpression;
+    /// Functor on the values
+    TFunctor myFunctor;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BinaryImageExpression
+  /**
+   * Description of template class 'BinaryImageExpression' <p>
+   * \brief Aim: node of an image expression which applies a functor to
+   * the values of two sub-expressions at the same point.
+   *
+   * The domain of the expression is the domain of the first
+   * sub-expression, which must be included in the domain of the
+   * second one.
+   *
+   * @tparam TExpression1 the type of the first sub-expression.
+   * @tparam TExpression2 the type of the second sub-expression.
+   * @tparam TFunctor a binary functor on the values of the sub-expressions.
+   * @tparam TValue the type of the values returned by the functor
+   * (default: TFunctor::result_type).
+   */
+  template <typename TExpression1, typename TExpression2, typename TFunctor,
+            typename TValue = typename TFunctor::result_type>
+  class BinaryImageExpression :
+    public ImageExpressionBase< BinaryImageExpression<TExpression1, TExpression2, TFunctor, TValue> >
+  {
+  public:
+    typedef BinaryImageExpression<TExpression1, TExpression2, TFunctor, TValue> Self;
+    typedef typename TExpression1::Domain Domain;
+    typedef typename TExpression1::Point Point;
+    typedef TValue Value;
+    typedef typename Domain::Size Size;
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    BOOST_STATIC_CONSTANT( bool, isConcurrent = ( TExpression1::isConcurrent
+                                                  && TExpression2::isConcurrent ) );
+
+    /**
+     * Constructor.
+     * @param anExpression1 the first sub-expression (copied).
+     * @param anExpression2 the second sub-expression (copied).
+     * @param aFunctor the functor (copied).
+     */
+    BinaryImageExpression ( const TExpression1 & anExpression1,
+                            const TExpression2 & anExpression2,
+                            const TFunctor & aFunctor ) :
+      myExpression1( anExpression1 ), myExpression2( anExpression2 ), myFunctor( aFunctor ) {}
+
+    /**
+     * @return the domain of the first sub-expression.
+     */
+    const Domain & domain() const
+    {
+      return myExpression1.domain();
+    }
+
+    /**
+     * @return the range of the values of the expression.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the value at @a aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const
+    {
+      return myFunctor( myExpression1( aPoint ), myExpression2( aPoint ) );
+    }
+
+    /**
+     * Evaluates the values of a span.
+     *
+     * @param aStart the first point of the span.
+     * @param aLength the number of points of the span.
+     * @param aOut (returns) the @a aLength values of the span.
+     */
+    void evaluateSpan ( const Point & aStart, const Size aLength, Value * aOut ) const;
+
+    /**
+     * @return 'true' if both sub-expressions are valid.
+     */
+    bool isValid() const
+    {
+      return myExpression1.isValid() && myExpression2.isValid();
+    }
+
+  private:
+    /// First sub-expression
+    TExpression1 myExpression1;
+    /// Second sub-expression
+    TExpression2 myExpression2;
+    /// Functor on the values
+    TFunctor myFunctor;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Factories and operators
+
+  /**
+   * @param anImage any image (aliased).
+   * @return the leaf of an expression on @a anImage.
+   * @tparam TImage a model of CConstImage.
+   */
+  template <typename TImage>
+  TerminalImageExpression<TImage>
+  imageExpression ( const TImage & anImage );
+
+  /**
+   * @param anExpression an expression.
+   * @param aFunctor a unary functor (with a result_type).
+   * @return the expression applying @a aFunctor to the values of @a anExpression.
+   */
+  template <typename TExpression, typename TFunctor>
+  UnaryImageExpression<TExpression, TFunctor>
+  transformExpression ( const ImageExpressionBase<TExpression> & anExpression,
+                        const TFunctor & aFunctor );
+
+  /**
+   * @param anExpression1 an expression.
+   * @param anExpression2 an expression.
+   * @param aFunctor a binary functor (with a result_type).
+   * @return the expression applying @a aFunctor to the values of the two expressions.
+   */
+  template <typename TExpression1, typename TExpression2, typename TFunctor>
+  BinaryImageExpression<TExpression1, TExpression2, TFunctor>
+  transformExpression ( const ImageExpressionBase<TExpression1> & anExpression1,
+                        const ImageExpressionBase<TExpression2> & anExpression2,
+                        const TFunctor & aFunctor );
+
+  /**
+   * @return the sum of two expressions with the same value type.
+   */
+  template <typename TExpression1, typename TExpression2>
+  BinaryImageExpression<TExpression1, TExpression2, std::plus<typename TExpression1::Value> >
+  operator+ ( const ImageExpressionBase<TExpression1> & anExpression1,
+              const ImageExpressionBase<TExpression2> & anExpression2 );
+
+  /**
+   * @return the difference of two expressions with the same value type.
+   */
+  template <typename TExpression1, typename TExpression2>
+  BinaryImageExpression<TExpression1, TExpression2, std::minus<typename TExpression1::Value> >
+  operator- ( const ImageExpressionBase<TExpression1> & anExpression1,
+              const ImageExpressionBase<TExpression2> & anExpression2 );
+
+  /**
+   * @return the product of two expressions with the same value type.
+   */
+  template <typename TExpression1, typename TExpression2>
+  BinaryImageExpression<TExpression1, TExpression2, std::multiplies<typename TExpression1::Value> >
+  operator* ( const ImageExpressionBase<TExpression1> & anExpression1,
+              const ImageExpressionBase<TExpression2> & anExpression2 );
+
+  /**
+   * Sets the value of each point of the domain of @a anImage to its
+   * value in @a anExpression. The domain of @a anImage, a
+   * HyperRectDomain, must be included in the domain of the
+   * expression.
+   *
+   * The expression is evaluated span by span along the first axis,
+   * the spans being written with ImageSpan. The spans are processed
+   * in parallel (OpenMP) when the leaves of the expression and the
+   * image are concurrent (see ImageSpan), e.g. for
+   * ImageContainerBySTLVector.
+   *
+   * @param anExpression an expression.
+   * @param anImage (returns) the image, model of CImage.
+   */
+  template <typename TExpression, typename TImage>
+  void materialize ( const ImageExpressionBase<TExpression> & anExpression,
+                     TImage & anImage );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageExpression.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageExpression_h
+
+#undef ImageExpression_RECURSES
+#endif // else defined(ImageExpression_RECURSES)
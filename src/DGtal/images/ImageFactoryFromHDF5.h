@@ -41,11 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/kernel/CBoundedNumber.h"
+#include "DGtal/io/HDF5ChunkedIO.h"
 
 #include "hdf5.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -316,6 +319,13 @@ namespace DGtal
     /**
      * Returns a pointer of an OutputImage created with the Domain aDomain.
      *
+     * When the dataset is chunked (and not compressed or compressed
+     * with ZLIB), the chunks intersecting aDomain are read entirely
+     * and decompressed in parallel (see HDF5ChunkedIO), so that
+     * requesting domains aligned with the chunks (e.g. the tiles of a
+     * TiledImage written with the same chunk size by HDF5Writer)
+     * decompresses each chunk once.
+     *
      * @param aDomain the domain.
      *
      * @return an ImagePtr.
@@ -331,67 +341,20 @@ namespace DGtal
       hsize_t offset[ddim];        // hyperslab offset in the file
       hsize_t count[ddim];         // size of the hyperslab in the file
 
-      herr_t status;
-      hsize_t dimsm[ddim];         // memory space dimensions
-      hid_t memspace;
-
-      hsize_t offset_out[ddim];    // hyperslab offset in memory
-      hsize_t count_out[ddim];     // size of the hyperslab in memory
-
-      int N_SUB[ddim];
       typename Domain::Integer d;
 
-      int malloc_size=1;
+      size_t malloc_size=1;
       for(d=0; d<ddim; d++)
       {
-        N_SUB[d] = (aDomain.upperBound()[ddim-d-1]-aDomain.lowerBound()[ddim-d-1])+1;
-        malloc_size = malloc_size*N_SUB[d];
-      }
-
-      Value *data_out = (Value*) malloc (malloc_size * sizeof(Value)); // output buffer
-      if (data_out == NULL)
-      {
-        trace.error() << "data_out malloc error in requestImage: " << (malloc_size * sizeof(Value)) << std::endl;
-        throw dgtalio;
-      }
-
-      // Define hyperslab in the dataset.
-      for(d=0; d<ddim; d++)
         offset[d] = aDomain.lowerBound()[ddim-d-1]-myDomain->lowerBound()[ddim-d-1];
-      for(d=0; d<ddim; d++)
-        count[d] = N_SUB[d];
-      status = H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offset, NULL, count, NULL);
-      if (status)
-      {
-        trace.error() << " H5Sselect_hyperslab from dataspace error" << std::endl;
-        throw dgtalio;
+        count[d] = (aDomain.upperBound()[ddim-d-1]-aDomain.lowerBound()[ddim-d-1])+1;
+        malloc_size = malloc_size*count[d];
       }
 
-      // Define the memory dataspace.
-      for(d=0; d<ddim; d++)
-        dimsm[d] = N_SUB[d];
-      memspace = H5Screate_simple(ddim,dimsm,NULL);
-
-      // Define memory hyperslab.
-      for(d=0; d<ddim; d++)
-        offset_out[d] = 0;
-      for(d=0; d<ddim; d++)
-        count_out[d] = N_SUB[d];
-      status = H5Sselect_hyperslab(memspace, H5S_SELECT_SET, offset_out, NULL, count_out, NULL);
-      if (status)
-      {
-        trace.error() << " H5Sselect_hyperslab from memspace error" << std::endl;
-        throw dgtalio;
-      }
+      std::vector<Value> data_out(malloc_size); // output buffer
 
-      // Read data from hyperslab in the file into the hyperslab in memory.
-      //status = H5Dread(dataset, H5T_NATIVE_INT, memspace, dataspace, H5P_DEFAULT, data_out);
-      status = H5DSpecializations<Self, Value>::H5DreadS(*this, memspace, data_out);
-      if (status)
-      {
-        trace.error() << " H5DSpecializations/H5DreadS error" << std::endl;
-        throw dgtalio;
-      }
+      // Read data from hyperslab in the file.
+      HDF5ChunkedIO<Value>::readHyperslab(dataset, offset, count, &data_out[0]);
 
       OutputImage* outputImage = new OutputImage(aDomain);
       if (outputImage == NULL)
@@ -400,29 +363,8 @@ namespace DGtal
         throw dgtalio;
       }
 
-      typedef SpaceND<ddim> TSpace;
-      typename TSpace::Point a, b;
-      for(d=0; d<ddim; d++)
-      {
-        a[d]=offset[ddim-d-1]+myDomain->lowerBound()[d];
-        b[d]=a[d]+N_SUB[ddim-d-1]-1;
-      }
-      HyperRectDomain<TSpace> hrdomain(a,b);
-
-      int p=0;
-      for( typename HyperRectDomain<TSpace>::ConstIterator
-            it = hrdomain.begin(), itend = hrdomain.end();
-          it != itend;
-          ++it)
-      {
-        outputImage->setValue((*it), data_out[ p++ ]);
-      }
-
-      H5Sclose(memspace);
-
-      // --
-
-      free(data_out);
+      // The HDF5 order (x varies the fastest) is the domain order.
+      std::copy(data_out.begin(), data_out.end(), outputImage->range().outputIterator());
 
       return outputImage;
     }
@@ -0,0 +1,264 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryFromRawFile.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageFactoryFromRawFile.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryFromRawFile_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryFromRawFile.h
+#else // defined(ImageFactoryFromRawFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryFromRawFile_RECURSES
+
+#if !defined ImageFactoryFromRawFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryFromRawFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryFromRawFile
+  /**
+   * Description of template class 'ImageFactoryFromRawFile' <p>
+   * \brief Aim: implements a factory to produce images from a raw
+   * binary file used as backing store (model of CImageFactory).
+   *
+   * The file stores the values of the whole domain, without header,
+   * in the native byte order and in the same order as
+   * ImageContainerBySTLVector (first axis is the fastest one). Values
+   * must be of a plain old data type (e.g. integers, points).
+   *
+   * Sub-images are read from and written to the file line by line
+   * (along the first axis), so that only the requested images are
+   * held in memory. Used with TiledImage, the file acts as a spill
+   * storage for images that do not fit in memory.
+   *
+   * The factory images production (images are copied, so it's a
+   * creation process) is done with the function 'requestImage' so the
+   * deletion must be done with the function 'detachImage'.
+   *
+   * The update of the file is done with the function 'flushImage'.
+   *
+   * @tparam TImageContainer an image container type (model of CImage)
+   * on a HyperRectDomain.
+   */
+  template <typename TImageContainer>
+  class ImageFactoryFromRawFile
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+    typedef ImageFactoryFromRawFile<TImageContainer> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+
+    ///Domain must be HyperRectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< HyperRectDomain<typename Domain::Space>,
+                          Domain >::value ));
+
+    ///New types
+    typedef ImageContainer OutputImage;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the domain of the whole image stored in the file.
+     * @param aFilename the raw file name.
+     * @param createFile if true, the file is created (or truncated)
+     * and sized to store the whole domain. Values which have never
+     * been flushed are read as zero bytes. Otherwise, the file must
+     * exist with the expected size.
+     * @param removeFile if true, the file is removed at destruction
+     * (scratch storage).
+     *
+     * @throw IOException if the file cannot be created or opened, or
+     * if it is too small for the domain (a file created by the
+     * constructor is then removed).
+     */
+    ImageFactoryFromRawFile(const Domain &aDomain,
+                            const std::string &aFilename,
+                            const bool createFile = true,
+                            const bool removeFile = false);
+
+    /**
+     * Destructor.
+     * Closes the file (and removes it if requested at construction).
+     */
+    ~ImageFactoryFromRawFile();
+
+  private:
+
+    ImageFactoryFromRawFile( const ImageFactoryFromRawFile & other );
+
+    ImageFactoryFromRawFile & operator=( const ImageFactoryFromRawFile & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /////////////////// Domains //////////////////
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /////////////////// Accessors //////////////////
+
+    /**
+     * @return the raw file name.
+     */
+    const std::string & filename() const
+    {
+      return myFilename;
+    }
+
+    /////////////////// API //////////////////
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myFile.is_open() && !myFile.fail();
+    }
+
+    /**
+     * Returns a pointer of an OutputImage created with the Domain
+     * aDomain and filled with the values stored in the file.
+     *
+     * @param aDomain the domain (must be included in the factory domain).
+     *
+     * @return an ImagePtr.
+     */
+    OutputImage * requestImage(const Domain &aDomain);
+
+    /**
+     * Flush (i.e. write/synchronize) an OutputImage to the file.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void flushImage(OutputImage* outputImage);
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the OutputImage.
+     */
+    void detachImage(OutputImage* outputImage)
+    {
+      delete outputImage;
+    }
+
+    // ------------------------- Private methods ------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the position of the value at @a aPoint in the file (in bytes).
+     */
+    std::streamoff offset(const Point &aPoint) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Domain of the whole image
+    Domain myDomain;
+
+    /// Raw file name
+    std::string myFilename;
+
+    /// True if the file is removed at destruction
+    bool myRemoveFile;
+
+    /// Raw file stream
+    mutable std::fstream myFile;
+
+    /// Line buffer
+    std::vector<Value> myLine;
+
+  }; // end of class ImageFactoryFromRawFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryFromRawFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryFromRawFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryFromRawFile<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryFromRawFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryFromRawFile_h
+
+#undef ImageFactoryFromRawFile_RECURSES
+#endif // else defined(ImageFactoryFromRawFile_RECURSES)
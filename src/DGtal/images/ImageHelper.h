@@ -56,8 +56,10 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/base/ConstAlias.h"
@@ -203,6 +205,209 @@ namespace DGtal
   template<typename I>
   void imageFromImage(I& aImg1, const I& aImg2); 
 
+  /// Kernels on the values of ImageContainerBySTLVector
+  /// 
+  /// The values of an ImageContainerBySTLVector are contiguous and
+  /// ordered as the domain points, the first coordinate varying
+  /// first. The following functions scan them line by line (or at
+  /// once when the points are not needed) with loops without
+  /// branches, that compilers vectorize (SIMD), instead of computing
+  /// the index of each point of the domain. The images given to a
+  /// same function must have the same domain.
+
+  /**
+   * Fill a set through the inserter @a ito
+   * with the points of the domain of @a aImg whose value is
+   * less than or equal to @a aThreshold (the values are
+   * scanned line by line). 
+   *
+   * @param aImg any image stored in a vector
+   * @param ito set inserter
+   * @param aThreshold any value (default: 0)
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type
+   * @tparam O any model of output iterator
+   */
+  template<typename D, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    const O& ito, 
+		    const V& aThreshold = 0); 
+
+  /**
+   * Fill a set through the inserter @a ito
+   * with the points of the domain of @a aImg whose value 
+   * lies between @a low and @a up (both included)
+   * (the values are scanned line by line). 
+   *
+   * @param aImg any image stored in a vector
+   * @param ito set inserter
+   * @param low lower value
+   * @param up upper value
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type
+   * @tparam O any model of output iterator
+   */
+  template<typename D, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    const O& ito, 
+		    const V& low,
+		    const V& up); 
+
+  /**
+   * Copy the values of @a aFun into @a aImg, the values
+   * being written in the order of the domain points
+   * without computing their index.
+   *
+   * @param aImg (returned) image stored in a vector
+   * @param aFun a unary functor
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type
+   * @tparam F any model of CPointFunctor
+   */
+  template<typename D, typename V, typename F>
+  void imageFromFunctor(ImageContainerBySTLVector<D,V>& aImg, const F& aFun); 
+
+  /**
+   * Set the values of @a aMask at @a aForeground for the points
+   * whose value in @a aImg is greater than @a aThreshold (as
+   * SimpleThresholdForegroundPredicate) and at 0 elsewhere.
+   *
+   * @param aImg any image stored in a vector
+   * @param aMask (returned) image with the same domain
+   * @param aThreshold any value
+   * @param aForeground value of the points above the threshold (default: 1)
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type of @a aImg
+   * @tparam M the value type of @a aMask
+   */
+  template<typename D, typename V, typename M>
+  void maskFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		     ImageContainerBySTLVector<D,M>& aMask, 
+		     const V& aThreshold, 
+		     M aForeground = NumberTraits<M>::ONE); 
+
+  /**
+   * Set the values of @a aMask at @a aForeground for the points
+   * whose value in @a aImg lies in ] @a low , @a up ] (as
+   * IntervalForegroundPredicate) and at 0 elsewhere.
+   *
+   * @param aImg any image stored in a vector
+   * @param aMask (returned) image with the same domain
+   * @param low lower value (excluded)
+   * @param up upper value (included)
+   * @param aForeground value of the points in the interval (default: 1)
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type of @a aImg
+   * @tparam M the value type of @a aMask
+   */
+  template<typename D, typename V, typename M>
+  void maskFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		     ImageContainerBySTLVector<D,M>& aMask, 
+		     const V& low, const V& up, 
+		     M aForeground = NumberTraits<M>::ONE); 
+
+  /**
+   * Set the value of each point in @a aOutput to the value returned
+   * by @a aFun for the value of the point in @a aImg,
+   * e.g. std::negate<V>(). @a aOutput may be @a aImg.
+   *
+   * @param aImg any image stored in a vector
+   * @param aOutput (returned) image with the same domain
+   * @param aFun a unary functor on values
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type of @a aImg
+   * @tparam W the value type of @a aOutput
+   * @tparam F a unary functor from V to W
+   */
+  template<typename D, typename V, typename W, typename F>
+  void transformImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		      ImageContainerBySTLVector<D,W>& aOutput, 
+		      const F& aFun); 
+
+  /**
+   * Set the value of each point in @a aOutput to the value returned
+   * by @a aFun for the values of the point in @a aImg1 and @a aImg2,
+   * e.g. std::plus<V>() for the sum of two images. @a aOutput may be
+   * one of the two images.
+   *
+   * @param aImg1 any image stored in a vector
+   * @param aImg2 any image with the same domain
+   * @param aOutput (returned) image with the same domain
+   * @param aFun a binary functor on values
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type of @a aImg1 and @a aImg2
+   * @tparam W the value type of @a aOutput
+   * @tparam F a binary functor from (V,V) to W
+   */
+  template<typename D, typename V, typename W, typename F>
+  void transformImage(const ImageContainerBySTLVector<D,V>& aImg1, 
+		      const ImageContainerBySTLVector<D,V>& aImg2, 
+		      ImageContainerBySTLVector<D,W>& aOutput, 
+		      const F& aFun); 
+
+  /**
+   * Compute the minimum and the maximum values of an image.
+   *
+   * @pre @a aImg must not be empty.
+   *
+   * @param aImg any image stored in a vector
+   * @param aMin (returned) minimum value
+   * @param aMax (returned) maximum value
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type
+   */
+  template<typename D, typename V>
+  void imageMinMax(const ImageContainerBySTLVector<D,V>& aImg, 
+		   V& aMin, V& aMax); 
+
+  /**
+   * Compute the histogram of the values of an image between @a low
+   * and @a up (both included), divided into as many bins of the
+   * same width as the size of @a aHistogram (the values out of
+   * [ @a low , @a up ] are not counted).
+   *
+   * @param aImg any image stored in a vector
+   * @param low lower value
+   * @param up upper value
+   * @param aHistogram (returned) number of values in each bin
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type
+   * @tparam C the counter type
+   */
+  template<typename D, typename V, typename C>
+  void imageHistogram(const ImageContainerBySTLVector<D,V>& aImg, 
+		      const V& low, const V& up, 
+		      std::vector<C>& aHistogram); 
+
+  /**
+   * Set the value of each point in @a aOutput to 
+   * @a aScale * v + @a aShift, where v is its value in @a aImg
+   * (the result is computed with doubles and then converted to W). 
+   * @a aOutput may be @a aImg.
+   *
+   * @param aImg any image stored in a vector
+   * @param aOutput (returned) image with the same domain
+   * @param aScale the scale factor
+   * @param aShift the shift
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V the value type of @a aImg
+   * @tparam W the value type of @a aOutput
+   */
+  template<typename D, typename V, typename W>
+  void rescaleImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    ImageContainerBySTLVector<D,W>& aOutput, 
+		    const double aScale, const double aShift = 0.0); 
+
   /**
    * Insert @a aPoint in @a aSet and if (and only if)
    * @a aPoint is a newly inserted point. 
@@ -242,6 +447,9 @@ namespace DGtal
    return res.second;  
    * @endcode
    *
+   * If S is a DigitalSetByBitVector, the search is a bit test
+   * (no iterator is built).
+   *
    * @see ImageContainerBySTLMap DigitalSetFromMap 
    * @see insertAndAlwaysSetValue
    */
@@ -290,6 +498,9 @@ namespace DGtal
    return flag; 
    * @endcode
    *
+   * If S is a DigitalSetByBitVector, the search is a bit test
+   * (no iterator is built).
+   *
    * @see ImageContainerBySTLMap DigitalSetFromMap 
    * @see insertAndSetValue
    */
@@ -323,6 +534,9 @@ namespace DGtal
    * @code
    * @endcode
    *
+   * If S is a DigitalSetByBitVector, the search is a bit test
+   * (no iterator is built).
+   *
    * @see ImageContainerBySTLMap DigitalSetFromMap 
    * @see insertAndSetValue
    */
@@ -46,6 +46,7 @@
 #include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/images/ImageContainerBySparseBlocks.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -54,6 +55,7 @@ namespace DGtal
   enum ImageIterability {  HIGH_ITER_IMAGE = 0 , LOW_ITER_I = 1};
   enum ImageBelongTestability {  HIGH_BEL_I = 0, LOW_BEL_I = 2 };
   enum ImageSpecificContainer { NORMAL_CONTAINER_I = 0, VTKIMAGEDATA_CONTAINER_I = 4 };
+  enum ImageDensity { DENSE_I = 0, SPARSE_I = 8 };
 
   /////////////////////////////////////////////////////////////////////////////
   // template class ImageSelector
@@ -61,6 +63,10 @@ namespace DGtal
    * Description of template class 'ImageSelector' <p>
    * \brief Aim:  Automatically defines an adequate image type according
    * to the hints given by the user.  
+   *
+   * The SPARSE_I hint, for images which are mostly equal to a
+   * background value, gives an ImageContainerBySparseBlocks whatever
+   * the other hints.
    */
   template <typename Domain,  typename Value, int Preferences = 0 >
   struct ImageSelector
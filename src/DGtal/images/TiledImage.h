@@ -214,10 +214,7 @@ namespace DGtal
       for(typename DGtal::Dimension i=0; i<Domain::dimension; i++)
         {
           lowerBoundCords[i] = 0;
-          upperBoundCoords[i] = myN;
-
-          if (((m_upperBound[i]-m_lowerBound[i]+1) % myN) == 0)
-            upperBoundCoords[i]--;
+          upperBoundCoords[i] = (m_upperBound[i]-m_lowerBound[i])/mySize[i]; // block coords of the last tile
         }
 
       return Domain(lowerBoundCords, upperBoundCoords);
@@ -693,6 +690,8 @@ namespace DGtal
           myImageCache->update(d);
           tile = myImageCache->getPage(d);
         }
+      else
+        myImageCache->incCacheHitRead();
 
       return tile;
     }
@@ -713,7 +712,10 @@ namespace DGtal
       res = myImageCache->read(aPoint, aValue);
 
       if (res)
-        return aValue;
+        {
+          myImageCache->incCacheHitRead();
+          return aValue;
+        }
       else
         {
           myImageCache->incCacheMissRead();
@@ -743,7 +745,10 @@ namespace DGtal
       ASSERT(myImageFactory->domain().isInside(aPoint));
 
       if (myImageCache->write(aPoint, aValue))
-        return;
+        {
+          myImageCache->incCacheHitWrite();
+          return;
+        }
       else
         {
           myImageCache->incCacheMissWrite();
@@ -752,6 +757,38 @@ namespace DGtal
         }
     }
 
+    /**
+     * Applies a functor to each tile of the image. The tiles are
+     * loaded by batches (through the cache, so the values not yet
+     * flushed are taken into account), the tiles of a batch are
+     * processed concurrently (with OpenMP) and the results are
+     * written in anOutput with its setValue method (e.g. through the
+     * write policy of an output TiledImage).
+     *
+     * For each tile, aFunctor( anInput, aResult ) is called:
+     *  - anInput is a copy of the values of the tile extended by aHalo
+     *    in each direction (clipped to the image domain),
+     *  - aResult is a copy of the values of the tile, which aFunctor
+     *    modifies.
+     *
+     * @tparam TTileFunctor a functor with a thread-safe method
+     * `void operator()( const OutputImage & anInput, OutputImage & aResult ) const`.
+     * @tparam TImage the type of anOutput (model of CImage with the same points and values).
+     *
+     * @param aFunctor the functor.
+     * @param anOutput the image where the results are written (must not be this image).
+     * @param aHalo the width of the halo of the tiles.
+     * @param aBatchSize the number of tiles processed at the same time.
+     * @param isParallel when 'true' and with OpenMP, the tiles of a
+     * batch are processed in parallel. When 'false', the tiles are
+     * processed one at a time (aBatchSize is ignored).
+     */
+    template <typename TTileFunctor, typename TImage>
+    void processTiles(const TTileFunctor & aFunctor, TImage & anOutput,
+                      typename Domain::Integer aHalo = 0,
+                      unsigned int aBatchSize = 16,
+                      bool isParallel = true) const;
+
     /**
      * Get the cacheMissRead value.
      */
@@ -769,7 +806,23 @@ namespace DGtal
     }
 
     /**
-     * Clear the cache and reset the cache misses
+     * Get the cacheHitRead value.
+     */
+    unsigned int getCacheHitRead()
+    {
+      return myImageCache->getCacheHitRead();
+    }
+
+    /**
+     * Get the cacheHitWrite value.
+     */
+    unsigned int getCacheHitWrite()
+    {
+      return myImageCache->getCacheHitWrite();
+    }
+
+    /**
+     * Clear the cache and reset the cache misses (and hits)
      */
     void clearCacheAndResetCacheMisses()
     {
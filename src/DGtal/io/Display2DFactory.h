@@ -262,7 +262,7 @@ static void draw( DGtal::Board2D & board, const DGtal::HyperRectDomain<TSpace> &
 // ImageContainerByHashTree
 template <typename C, typename Domain, typename Value, typename HashKey>
 static void drawImageRecursive( DGtal::Board2D & aBoard, 
-                         const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey> & i,
+                         const DGtal::ImageContainerByHashTree<Domain, Value, HashKey> & i,
                          HashKey key,
                          const double p[2],
                          const double len,
@@ -271,7 +271,7 @@ static void drawImageRecursive( DGtal::Board2D & aBoard,
 
 template <typename C, typename Domain, typename Value, typename HashKey>
 static void drawImageHashTree( Board2D & board,
-                const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey> &,
+                const DGtal::ImageContainerByHashTree<Domain, Value, HashKey> &,
                 const Value &, const Value & );
 // ImageContainerByHashTree
 
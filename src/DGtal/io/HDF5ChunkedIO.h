@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HDF5ChunkedIO.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HDF5ChunkedIO.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HDF5ChunkedIO_RECURSES)
+#error Recursive header files inclusion detected in HDF5ChunkedIO.h
+#else // defined(HDF5ChunkedIO_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HDF5ChunkedIO_RECURSES
+
+#if !defined HDF5ChunkedIO_h
+/** Prevents repeated inclusion of headers. */
+#define HDF5ChunkedIO_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include <hdf5.h>
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(H5_VERSION_GE)
+#if !H5_VERSION_GE(1,10,3)
+#error HDF5ChunkedIO requires HDF5 >= 1.10.3 (H5Dread_chunk / H5Dwrite_chunk)
+#endif
+#else
+#error HDF5ChunkedIO requires HDF5 >= 1.10.3 (H5Dread_chunk / H5Dwrite_chunk)
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HDF5ChunkedIO
+  /**
+   * Description of template struct 'HDF5ChunkedIO' <p>
+   * \brief Aim: read and write the values of a HDF5 dataset chunk by
+   * chunk, (de)compressing the chunks in parallel.
+   *
+   * When a dataset is chunked, either without filter or with the
+   * ZLIB/DEFLATE filter only, and when its datatype is the native
+   * type of @a TValue, the chunks are transferred as raw data
+   * (H5Dread_chunk / H5Dwrite_chunk) and (de)compressed with ZLIB
+   * outside of the HDF5 library. The HDF5 calls are serialized since
+   * the library is not thread-safe, whereas the (de)compression and
+   * the copies between the chunks and the user buffer are done in
+   * parallel when OpenMP is enabled (WITH_OPENMP). Each chunk is
+   * decompressed once, whatever the position of the hyperslab.
+   *
+   * For the other datasets, the classical H5Dread / H5Dwrite calls
+   * are used.
+   *
+   * Buffers and hyperslabs are given in the HDF5 order: the first
+   * coordinate varies the slowest, i.e. it is the last coordinate of
+   * the DGtal points.
+   *
+   * @tparam TValue the value type, one of DGtal::uint8_t,
+   * DGtal::int8_t, DGtal::uint16_t, DGtal::int16_t, DGtal::uint32_t,
+   * DGtal::int32_t, DGtal::uint64_t, DGtal::int64_t, float or double.
+   *
+   * @see HDF5Reader, HDF5Writer, ImageFactoryFromHDF5
+   */
+  template <typename TValue>
+  struct HDF5ChunkedIO
+  {
+    // ----------------------- Standard services ------------------------------
+    typedef TValue Value;
+
+    /**
+     * @return the HDF5 native datatype of Value.
+     */
+    static hid_t nativeType();
+
+    /**
+     * Reads a hyperslab of a dataset.
+     *
+     * @param aDataset an open dataset.
+     * @param aOffset the offset of the hyperslab (one value per dimension of the dataset).
+     * @param aCount the size of the hyperslab (one value per dimension of the dataset).
+     * @param aBuffer (returns) the values of the hyperslab (the size
+     * of the buffer must be the product of the elements of aCount).
+     */
+    static void readHyperslab(hid_t aDataset, const hsize_t * aOffset, const hsize_t * aCount,
+                              Value * aBuffer) throw(DGtal::IOException);
+
+    /**
+     * Writes all the values of a dataset.
+     *
+     * @param aDataset an open dataset.
+     * @param aBuffer the values of the dataset.
+     */
+    static void writeDataset(hid_t aDataset, const Value * aBuffer) throw(DGtal::IOException);
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Dataset layout as seen by the chunked transfers.
+     */
+    struct Layout
+    {
+      /// Dataset dimensions
+      std::vector<hsize_t> dims;
+      /// Chunk dimensions
+      std::vector<hsize_t> chunk;
+      /// True if the chunks can be transferred as raw data
+      bool direct;
+      /// True if the chunks are compressed with ZLIB
+      bool deflate;
+      /// ZLIB compression level
+      int level;
+      /// Fill value of the unallocated chunks
+      Value fill;
+    };
+
+    /**
+     * Gets the layout of a dataset.
+     *
+     * @param aDataset an open dataset.
+     * @param aLayout (returns) the layout.
+     */
+    static void layout(hid_t aDataset, Layout & aLayout) throw(DGtal::IOException);
+
+    /**
+     * Copies the box [aLow, aUp) from an array to another one. Both
+     * arrays are boxes of the same space given by their origin and
+     * their dimensions, and must contain the copied box.
+     *
+     * @param aSource the source array.
+     * @param aSourceOrigin origin of the source array.
+     * @param aSourceDims dimensions of the source array.
+     * @param aTarget the target array.
+     * @param aTargetOrigin origin of the target array.
+     * @param aTargetDims dimensions of the target array.
+     * @param aLow lower corner of the copied box.
+     * @param aUp upper corner (excluded) of the copied box.
+     */
+    static void copyBox(const Value * aSource, const std::vector<hsize_t> & aSourceOrigin,
+                        const std::vector<hsize_t> & aSourceDims,
+                        Value * aTarget, const std::vector<hsize_t> & aTargetOrigin,
+                        const std::vector<hsize_t> & aTargetDims,
+                        const std::vector<hsize_t> & aLow, const std::vector<hsize_t> & aUp);
+
+  }; // end of struct HDF5ChunkedIO
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/HDF5ChunkedIO.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HDF5ChunkedIO_h
+
+#undef HDF5ChunkedIO_RECURSES
+#endif // else defined(HDF5ChunkedIO_RECURSES)
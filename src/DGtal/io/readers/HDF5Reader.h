@@ -101,6 +101,9 @@ namespace DGtal
     /** 
      * Main method to import a HDF5 image file with 3D UInt8 image dataset(s)
      * into an instance of the template parameter ImageContainer.
+     *
+     * Chunked datasets are read chunk by chunk, the chunks being
+     * decompressed in parallel (see HDF5ChunkedIO).
      * 
      * @param aFilename the file name to import.
      * @param aDataset the dataset name to import.
@@ -118,6 +118,23 @@ namespace DGtal
     static ImageContainer importRaw8(const std::string & filename,
 				     const Vector & extent,
 				     const Functor & aFunctor =  Functor()) throw(DGtal::IOException);
+
+    /** 
+     * Maps the values of a Raw (8bits) file in memory instead of
+     * reading them: the template parameter ImageContainer must be an
+     * ImageContainerByMappedFile with unsigned char values (the
+     * functor is not used).
+     * 
+     * @param filename the file name to map.
+     * @param extent the size of the raw data set.
+     * @param isCopyOnWrite if true, the values can be modified (in
+     * memory only), otherwise they are read-only.
+     *
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer mapRaw8(const std::string & filename,
+				  const Vector & extent,
+				  const bool isCopyOnWrite = false) throw(DGtal::IOException);
     
   }; // end of class RawReader
 
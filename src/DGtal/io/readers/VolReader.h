@@ -112,11 +112,35 @@ namespace DGtal
      */
     static ImageContainer importVol(const std::string & filename, 
 				    const Functor & aFunctor =  Functor()) throw(DGtal::IOException);
-    
-   
+
+    /** 
+     * Maps the values of a Vol file in memory instead of reading
+     * them: the template parameter ImageContainer must be an
+     * ImageContainerByMappedFile with unsigned char values (the
+     * functor is not used).
+     * 
+     * @param filename the file name to map.
+     * @param isCopyOnWrite if true, the values can be modified (in
+     * memory only), otherwise they are read-only.
+     *
+     * @return an instance of the ImageContainer.
+     */
+    static ImageContainer mapVol(const std::string & filename,
+				 const bool isCopyOnWrite = false) throw(DGtal::IOException);
     
   private:
 
+    /**
+     * Reads the header of a Vol file, the file position being then
+     * at the beginning of the values.
+     *
+     * @param fin the opened file.
+     * @param sx (returns) the size along the first axis.
+     * @param sy (returns) the size along the second axis.
+     * @param sz (returns) the size along the third axis.
+     */
+    static void readHeader(FILE * fin, int & sx, int & sy, int & sz) throw(DGtal::IOException);
+
     typedef unsigned char voxel;
     // This class help us to associate a field type and his value.
     // An object is a pair (type, value). You can copy and assign
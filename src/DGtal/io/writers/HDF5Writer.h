@@ -71,12 +71,14 @@ namespace DGtal
     typedef TImage Image;
     typedef typename TImage::Value Value;
     typedef TFunctor Functor;
+    typedef typename TImage::Domain::Vector Vector;
     
     BOOST_CONCEPT_ASSERT((  CUnaryFunctor<TFunctor, Value, unsigned char> )) ;    
     BOOST_STATIC_ASSERT(TImage::Domain::dimension == 3);
 
     /** 
-     * Export a 3D UInt8 HDF5 output file with ZLIB compression activated.
+     * Export a 3D UInt8 HDF5 output file with ZLIB compression
+     * activated (chunks of 64^3 values, fastest compression level 1).
      * 
      * @param filename name of the output file
      * @param aImage the image to export
@@ -86,6 +88,28 @@ namespace DGtal
      */
     static bool exportHDF5_3D(const std::string & filename, const Image &aImage, const std::string & aDataset,
 			  const Functor & aFunctor = Functor()) throw(DGtal::IOException);
+
+    /** 
+     * Export a 3D UInt8 HDF5 output file with a given chunk size and
+     * ZLIB compression level. The chunks are compressed in parallel
+     * (see HDF5ChunkedIO).
+     *
+     * To read the file with a TiledImage of N tiles per dimension
+     * (see ImageFactoryFromHDF5), the chunk size should divide the
+     * tile size, i.e. the domain extent divided by N, so that each
+     * chunk is decompressed for one tile only.
+     * 
+     * @param filename name of the output file
+     * @param aImage the image to export
+     * @param aDataset the dataset name to export.
+     * @param aChunkSize the size of the chunks (clamped to the domain extent).
+     * @param aCompressionLevel the ZLIB compression level, from 0 (no compression) to 9 (default 1, the fastest).
+     * @param aFunctor functor used to cast image values
+     * @return true if no errors occur.
+     */
+    static bool exportHDF5_3D(const std::string & filename, const Image &aImage, const std::string & aDataset,
+			  const Vector & aChunkSize, int aCompressionLevel = 1,
+			  const Functor & aFunctor = Functor()) throw(DGtal::IOException);
   };
 }//namespace
 
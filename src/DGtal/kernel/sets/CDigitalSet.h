@@ -127,7 +127,7 @@ namespace DGtal
     
  ### Models
 
-- DigitalSetBySTLVector, DigitalSetBySTLSet, DigitalSetFromMap
+- DigitalSetBySTLVector, DigitalSetBySTLSet, DigitalSetByHashTable, DigitalSetFromMap
     
  ### Notes
 
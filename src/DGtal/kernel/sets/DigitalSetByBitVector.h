@@ -0,0 +1,550 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitVector.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByBitVector.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitVector.h
+#else // defined(DigitalSetByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitVector_RECURSES
+
+#if !defined DigitalSetByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/array.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitVector
+  /**
+    Description of template class 'DigitalSetByBitVector' <p> \brief
+    Aim: Realizes the concept CDigitalSet by using one bit per point
+    of the domain.
+
+    It thus describes a modifiable set of points within the given
+    domain [Domain], which must be a HyperRectDomain (or any domain
+    whose points are exactly the points of its bounding box). The
+    memory footprint is a bit per domain point whatever the number of
+    points in the set: it is suited to dense sets (e.g. shapes in
+    volumes) with many membership tests, which are O(1).
+
+    Bits are ordered like the points of the domain (first coordinate
+    varying first), so that iterations visit the points in the domain
+    order. Iterators skip 64 points at once when words are empty and
+    find the set bits with count trailing zeros instructions.
+    Complement, union (operator+=), intersection (operator&=),
+    difference (operator-=) and translation (assignFromTranslation)
+    between sets of the same domain are computed word by word. They
+    are used by Object::border, which computes the border of a set as
+    the set minus its erosion.
+
+    Iterators are not invalidated by insertions or removals of other
+    points.
+
+    @tparam TDomain a HyperRectDomain.
+    @see CDigitalSet,HyperRectDomain,DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitVector
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitVector<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Size Size;
+
+    /// Type of the words storing the bits.
+    typedef DGtal::uint64_t Word;
+
+    /**
+     * Bidirectional readable iterator on the points of the set (the
+     * set bits).
+     */
+    class ConstIterator
+      : public boost::iterator_facade<ConstIterator, Point const,
+                                      boost::bidirectional_traversal_tag,
+                                      Point const &>
+    {
+    public:
+      /**
+       * Default constructor (not valid).
+       */
+      ConstIterator() : mySet( 0 ), myIndex( 0 ), myPoint() {}
+
+      /**
+       * Constructor.
+       * @param aSet the visited set.
+       * @param anIndex the index of a set bit, or the number of bits
+       * for the past-the-end iterator.
+       */
+      ConstIterator( const DigitalSetByBitVector* aSet, const std::size_t anIndex )
+        : mySet( aSet ), myIndex( anIndex ), myPoint()
+      {
+        if ( myIndex < mySet->myNbBits )
+          myPoint = mySet->pointFromIndex( myIndex );
+      }
+
+      /// @return the index of the bit of the current point.
+      std::size_t index() const
+      {
+        return myIndex;
+      }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      const Point & dereference() const
+      {
+        return myPoint;
+      }
+
+      void increment()
+      {
+        myIndex = mySet->nextIndex( myIndex + 1 );
+        if ( myIndex < mySet->myNbBits )
+          myPoint = mySet->pointFromIndex( myIndex );
+      }
+
+      void decrement()
+      {
+        myIndex = mySet->previousIndex( myIndex );
+        myPoint = mySet->pointFromIndex( myIndex );
+      }
+
+      bool equal( const ConstIterator & other ) const
+      {
+        return myIndex == other.myIndex;
+      }
+
+      /// The visited set
+      const DigitalSetByBitVector* mySet;
+      /// Index of the current bit
+      std::size_t myIndex;
+      /// Current point
+      Point myPoint;
+    };
+
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitVector( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitVector ( const DigitalSetByBitVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator= ( const DigitalSetByBitVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set (same as insert for this container).
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitVector<Domain> & operator+=
+    ( const DigitalSetByBitVector<Domain> & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitVector<Domain> & operator&=
+    ( const DigitalSetByBitVector<Domain> & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByBitVector<Domain> & operator-=
+    ( const DigitalSetByBitVector<Domain> & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitVector<Domain> & other_set );
+
+    /**
+     * Builds in this the set of the points p of the domain such that
+     * p + [v] belongs to the set [other_set], the points outside of
+     * the domain belonging to [other_set] if and only if [outside]
+     * is 'true'. The bits are copied row by row (along the first
+     * axis), by shifts of words.
+     *
+     * @param other_set any other set with the same domain bounds.
+     * @param v any vector.
+     * @param outside the membership of the points outside of the domain.
+     */
+    void assignFromTranslation( const DigitalSetByBitVector<Domain> & other_set,
+                                const Vector & v, bool outside );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /**
+     * Lower bound of the domain.
+     */
+    Point myLowerBound;
+
+    /**
+     * Upper bound of the domain.
+     */
+    Point myUpperBound;
+
+    /**
+     * Number of bits (number of points of the domain).
+     */
+    std::size_t myNbBits;
+
+    /**
+     * Number of points in the set.
+     */
+    Size mySize;
+
+    /**
+     * The bits (the unused bits of the last word are always 0).
+     */
+    std::vector<Word> myWords;
+
+    // --------------- CDrawableWithBoard2D realization --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p a point of the domain.
+     * @return the index of the bit of [p].
+     */
+    std::size_t indexFromPoint( const Point & p ) const;
+
+    /**
+     * @param i the index of a bit.
+     * @return the point of the bit [i].
+     */
+    Point pointFromIndex( std::size_t i ) const;
+
+    /**
+     * @param i the index of a bit.
+     * @return the index of the first set bit from [i] (included), or
+     * myNbBits.
+     */
+    std::size_t nextIndex( std::size_t i ) const;
+
+    /**
+     * @param i the index of a bit (myNbBits for the end).
+     * @return the index of the last set bit before [i] (excluded).
+     * @pre there is such a bit.
+     */
+    std::size_t previousIndex( std::size_t i ) const;
+
+    /**
+     * @param other any set.
+     * @return 'true' if [other] has the same domain bounds as this.
+     */
+    bool sameBounds( const DigitalSetByBitVector & other ) const;
+
+    /**
+     * Clears the unused bits of the last word and recomputes the size.
+     */
+    void updateSize();
+
+    /**
+     * @param i the index of a bit.
+     * @param n a number of bits, between 1 and 64.
+     * @return the bits [i,i+n) in the lowest bits of a word.
+     */
+    Word readBits( std::size_t i, unsigned int n ) const;
+
+    /**
+     * Replaces the bits [i,i+n).
+     * @param i the index of a bit.
+     * @param n a number of bits, between 1 and 64.
+     * @param bits the new bits, in the lowest [n] bits.
+     */
+    void writeBits( std::size_t i, unsigned int n, Word bits );
+
+    /**
+     * Replaces the bits [i,i+n) by the bits [j,j+n) of [other].
+     * @param i the index of a bit of this.
+     * @param other any set with the same domain bounds.
+     * @param j the index of a bit of [other].
+     * @param n a number of bits.
+     */
+    void copyBits( std::size_t i, const DigitalSetByBitVector & other,
+                   std::size_t j, std::size_t n );
+
+    /**
+     * Sets the bits [i,i+n) to [value].
+     * @param i the index of a bit.
+     * @param n a number of bits.
+     * @param value the new value of the bits.
+     */
+    void fillBits( std::size_t i, std::size_t n, bool value );
+
+  }; // end of class DigitalSetByBitVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+         const DigitalSetByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitVector_h
+
+#undef DigitalSetByBitVector_RECURSES
+#endif // else defined(DigitalSetByBitVector_RECURSES)
@@ -0,0 +1,443 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByHashTable.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByHashTable.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByHashTable_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByHashTable.h
+#else // defined(DigitalSetByHashTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByHashTable_RECURSES
+
+#if !defined DigitalSetByHashTable_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByHashTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/array.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByHashTable
+  /**
+    Description of template class 'DigitalSetByHashTable' <p> \brief
+    Aim: Realizes the concept CDigitalSet by using a hash table with
+    open addressing.
+
+    It thus describes a modifiable set of points within the given
+    domain [Domain], with expected constant time insertion, removal
+    and membership test, and without any per-point allocation.
+
+    The points are stored contiguously in a std::vector (so that
+    iterations are as fast as with DigitalSetBySTLVector), and the
+    table is an array of 64-bit slots (linear probing, load factor at
+    most 1/2) storing the index of the point in this vector together
+    with the upper half of its hash value, so that most unsuccessful
+    probes do not access the points. The hash value is computed from
+    the coordinates packed into a single 64-bit integer (linearization
+    of the point in the domain bounding box) followed by a bit mixing
+    function.
+
+    Removing a point moves the last point of the vector in its place:
+    like with DigitalSetBySTLVector, iterators are thus invalidated by
+    erase(), and the iteration order is not the lexicographic
+    order. The number of points is bounded by 2^32 - 3.
+
+    @tparam TDomain a realization of the concept CDomain.
+    @see CDigitalSet,CDomain,DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByHashTable
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByHashTable<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename std::vector<Point>::const_iterator Iterator;
+    typedef typename std::vector<Point>::const_iterator ConstIterator;
+
+    /// Type of the slots of the table.
+    typedef DGtal::uint64_t Slot;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByHashTable();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByHashTable( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByHashTable ( const DigitalSetByHashTable & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByHashTable & operator= ( const DigitalSetByHashTable & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set. There is no defined behavior if the point is already in
+     * the set (for instance, may be present twice).
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The collection should contain distinct points. Each
+     * of these points should also not belong already to the set.
+     * There is no defined behavior if the preceding requisites
+     * are not satisfied (for instance, points may be present several
+     * times in the set).
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * Prepares the set to contain [n] points without reallocation of
+     * the table.
+     *
+     * @param n the expected number of points.
+     */
+    void reserve( const Size n );
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    Iterator find( const Point & p );
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    Iterator begin();
+
+    /**
+     * @return a iterator on the element after the last in this set.
+     */
+    Iterator end();
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    DigitalSetByHashTable<Domain> & operator+=
+    ( const DigitalSetByHashTable<Domain> & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByHashTable<Domain> & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /**
+     * The container storing the points of the set.
+     */
+    std::vector<Point> myVector;
+
+    /**
+     * The hash table (a power of two number of slots).
+     */
+    std::vector<Slot> mySlots;
+
+    /**
+     * Number of slots marking erased points.
+     */
+    Size myNbErased;
+
+    /**
+     * Lower bound of the domain bounding box.
+     */
+    Point myLowerBound;
+
+    /**
+     * Multipliers used to pack the coordinates of a point into a
+     * single integer (linearization in the bounding box of the domain).
+     */
+    boost::array<DGtal::uint64_t, Space::dimension> myStrides;
+
+    // --------------- CDrawableWithBoard2D realization --------------------
+  public:
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByHashTable();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any digital point.
+     * @return the hash value of [p].
+     */
+    DGtal::uint64_t hash( const Point & p ) const;
+
+    /**
+     * @param p any digital point.
+     * @param h the hash value of [p].
+     * @return the index of the slot of [p] or mySlots.size() if [p]
+     * does not belong to the set.
+     */
+    std::size_t findSlot( const Point & p, const DGtal::uint64_t h ) const;
+
+    /**
+     * Stores the index [i] of a point of hash value [h] in the first
+     * free slot of its probing sequence.
+     * @pre the point should not belong to the table.
+     */
+    void insertIndex( const std::size_t i, const DGtal::uint64_t h );
+
+    /**
+     * Rebuilds the table with [n] slots.
+     * @param n a power of two greater than twice the number of points.
+     */
+    void rehash( const std::size_t n );
+
+    /**
+     * Computes myStrides from the domain bounding box.
+     */
+    void initStrides();
+
+  }; // end of class DigitalSetByHashTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByHashTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByHashTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+         const DigitalSetByHashTable<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByHashTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByHashTable_h
+
+#undef DigitalSetByHashTable_RECURSES
+#endif // else defined(DigitalSetByHashTable_RECURSES)
@@ -48,6 +48,9 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetByHashTable.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -80,6 +83,14 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Big sets with a high variability and many belonging tests
+   * (e.g. sparse point clouds) are represented by
+   * DigitalSetByHashTable, small sets with low variability by
+   * DigitalSetBySTLVector, and other sets by DigitalSetBySTLSet.
+   * Sets of a HyperRectDomain which may contain the whole domain and
+   * with many belonging tests (e.g. shapes in a volume) are
+   * represented by DigitalSetByBitVector.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
@@ -99,7 +99,8 @@ namespace DGtal
 
    /**
      * @param p any point.
-     * @return true iff p is in the domain.
+     * @return true iff p is in the set (the set being used as a
+     * point predicate, e.g. a bit test for DigitalSetByBitVector).
      */
     bool operator()( const Point & p ) const;
 
@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MixedRadixFFT.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MixedRadixFFT.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MixedRadixFFT_RECURSES)
+#error Recursive header files inclusion detected in MixedRadixFFT.h
+#else // defined(MixedRadixFFT_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MixedRadixFFT_RECURSES
+
+#if !defined MixedRadixFFT_h
+/** Prevents repeated inclusion of headers. */
+#define MixedRadixFFT_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <complex>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MixedRadixFFT
+  /**
+   * Description of class 'MixedRadixFFT' <p>
+   * \brief Aim: self-contained discrete Fourier transform of complex
+   * sequences whose size is a product of 2, 3 and 5 (mixed radix,
+   * decimation in time), and of multidimensional arrays of such
+   * sequences.
+   *
+   * A MixedRadixFFT object is a plan for one size: it stores the
+   * factorization of the size and the twiddle factors. The forward
+   * transform computes \f$ X_k = \sum_j x_j e^{-2i\pi jk/n} \f$, the
+   * backward transform uses the conjugated twiddle factors and is not
+   * normalized.
+   *
+   * The static method transform() applies the plans along each axis
+   * of a multidimensional array, the lines of an axis being
+   * transformed in parallel when OpenMP is enabled (WITH_OPENMP).
+   * Use goodSize() to pad the arrays to a valid size.
+   *
+   * @code
+   * std::vector< MixedRadixFFT::Complex > data( 60 * 45 );
+   * std::vector< unsigned int > extents( 2 );
+   * extents[ 0 ] = 60; extents[ 1 ] = 45;
+   * MixedRadixFFT::transform( data, extents, false ); // forward
+   * MixedRadixFFT::transform( data, extents, true );  // backward, normalized
+   * @endcode
+   */
+  class MixedRadixFFT
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef std::complex< double > Complex;
+
+    /**
+     * Constructor. Builds the plan of the transforms of size @a aSize.
+     *
+     * @param aSize the size of the sequences, a product of 2, 3
+     * and 5 (see goodSize()).
+     */
+    MixedRadixFFT( const unsigned int aSize );
+
+    /**
+     * Destructor.
+     */
+    ~MixedRadixFFT() {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aSize any positive size.
+     * @return the smallest product of 2, 3 and 5 greater or equal to @a aSize.
+     */
+    static unsigned int goodSize( const unsigned int aSize );
+
+    /**
+     * @return the size of the transformed sequences.
+     */
+    unsigned int size() const;
+
+    /**
+     * Transforms a sequence (out-of-place).
+     *
+     * @param aInput the input sequence (size() values, stride @a aStride).
+     * @param aOutput (returns) the transformed sequence (size()
+     * contiguous values), must not overlap @a aInput.
+     * @param aBackward if true, computes the backward (unnormalized)
+     * transform, otherwise the forward one.
+     * @param aStride the distance between two values of the input.
+     */
+    void transform( const Complex * aInput, Complex * aOutput,
+                    const bool aBackward, const unsigned int aStride = 1 ) const;
+
+    /**
+     * Transforms a multidimensional array in place, the first axis
+     * varying the fastest. The backward transform is normalized, so
+     * that it inverts the forward one.
+     *
+     * @param aData the values of the array.
+     * @param aExtents the extents of the array along each axis, each
+     * of them a product of 2, 3 and 5.
+     * @param aBackward if true, computes the backward transform,
+     * otherwise the forward one.
+     */
+    static void transform( std::vector< Complex > & aData,
+                           const std::vector< unsigned int > & aExtents,
+                           const bool aBackward );
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Size of the sequences
+    unsigned int mySize;
+
+    /// Radices of the stages, the first stage first
+    std::vector< unsigned int > myFactors;
+
+    /// Forward twiddle factors exp(-2i.pi.k/n), k in [0,n)
+    std::vector< Complex > myTwiddles;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Recursive decimation in time: transforms the @a aSize values of
+     * @a aInput taken with stride @a aStride into @a aOutput.
+     *
+     * @param aOutput (returns) the transformed values (contiguous).
+     * @param aInput the first input value.
+     * @param aSize the size of the sub-transform.
+     * @param aStride the stride of the input values.
+     * @param aTwiddleStride the stride in the twiddle factors (mySize / aSize).
+     * @param aFactor index of the stage in myFactors.
+     * @param aBackward if true, uses the conjugated twiddle factors.
+     */
+    void recursiveTransform( Complex * aOutput, const Complex * aInput,
+                             const unsigned int aSize, const unsigned int aStride,
+                             const unsigned int aTwiddleStride,
+                             const unsigned int aFactor, const bool aBackward ) const;
+
+  }; // end of class MixedRadixFFT
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MixedRadixFFT'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MixedRadixFFT' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MixedRadixFFT & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/MixedRadixFFT.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MixedRadixFFT_h
+
+#undef MixedRadixFFT_RECURSES
+#endif // else defined(MixedRadixFFT_RECURSES)
@@ -105,12 +105,12 @@ details.
 - \e Vector: the type for defining vectors in \e Space  (same as Space::Vector).
 - \e Cells: a container that stores unsigned cells (not a set, rather a enumerable collection type, model of CConstSinglePassRange).
 - \e SCells: a container that stores signed cells (not a set, rather a enumerable collection type, model of CConstSinglePassRange).
-- \e CellSet: a set container that stores unsigned cells (efficient for queries like \c find, model of boost::UniqueAssociativeContainer and boost::SimpleAssociativeContainer).
-- \e SCellSet: a set container that stores signed cells (efficient for queries like \c find, model of boost::UniqueAssociativeContainer and boost::SimpleAssociativeContainer).
-- \e SurfelSet: a set container that stores surfels, i.e. signed n-1-cells (efficient for queries like \c find, model of boost::UniqueAssociativeContainer and boost::SimpleAssociativeContainer).
-- \e CellMap<Value>: an associative container Cell->Value rebinder type (efficient for key queries). Use as \c typename X::template CellMap<Value>::Type, which is a model of boost::UniqueAssociativeContainer and boost::PairAssociativeContainer.
-- \e SCellMap<Value>: an associative container SCell->Value rebinder type (efficient for key queries). Use as \c typename X::template SCellMap<Value>::Type, which is a model of boost::UniqueAssociativeContainer and boost::PairAssociativeContainer.
-- \e SurfelMap<Value>: an associative container Surfel->Value rebinder type (efficient for key queries). Use as \c typename X::template SurfelMap<Value>::Type, which is a model of boost::UniqueAssociativeContainer and boost::PairAssociativeContainer.
+- \e CellSet: a set container that stores unsigned cells (efficient for queries like \c find, ordered or hashed set, model of boost::ForwardContainer).
+- \e SCellSet: a set container that stores signed cells (efficient for queries like \c find, ordered or hashed set, model of boost::ForwardContainer).
+- \e SurfelSet: a set container that stores surfels, i.e. signed n-1-cells (efficient for queries like \c find, ordered or hashed set, model of boost::ForwardContainer).
+- \e CellMap<Value>: an associative container Cell->Value rebinder type (efficient for key queries). Use as \c typename X::template CellMap<Value>::Type, which is an ordered or hashed map, model of boost::ForwardContainer.
+- \e SCellMap<Value>: an associative container SCell->Value rebinder type (efficient for key queries). Use as \c typename X::template SCellMap<Value>::Type, which is an ordered or hashed map, model of boost::ForwardContainer.
+- \e SurfelMap<Value>: an associative container Surfel->Value rebinder type (efficient for key queries). Use as \c typename X::template SurfelMap<Value>::Type, which is an ordered or hashed map, model of boost::ForwardContainer.
 
 
 \note DirIterator should be use as follows:
@@ -347,18 +347,27 @@ public:
   BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Vector, typename Space::Vector >::value ));
   BOOST_CONCEPT_ASSERT(( CConstSinglePassRange< Cells > ));
   BOOST_CONCEPT_ASSERT(( CConstSinglePassRange< SCells > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< CellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SCellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SurfelSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< CellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< SCellSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::SimpleAssociativeContainer< SurfelSet > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< CellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SCellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::UniqueAssociativeContainer< SurfelMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< CellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< SCellMap > ));
-  BOOST_CONCEPT_ASSERT(( boost::PairAssociativeContainer< SurfelMap > ));
+  // Sets and maps may be ordered or hashed containers: the
+  // associative container concepts of boost require an ordering
+  // (key_compare), hence only the types and the queries are checked.
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< CellSet > ));
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< SCellSet > ));
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< SurfelSet > ));
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< CellMap > ));
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< SCellMap > ));
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< SurfelMap > ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Cell, typename CellSet::key_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Cell, typename CellSet::value_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< SCell, typename SCellSet::key_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< SCell, typename SCellSet::value_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Surfel, typename SurfelSet::key_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Surfel, typename SurfelSet::value_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Cell, typename CellMap::key_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Dummy, typename CellMap::mapped_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< SCell, typename SCellMap::key_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Dummy, typename SCellMap::mapped_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Surfel, typename SurfelMap::key_type >::value ));
+  BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Dummy, typename SurfelMap::mapped_type >::value ));
 
   BOOST_CONCEPT_USAGE( CCellularGridSpaceND )
   {
@@ -367,8 +376,30 @@ public:
     ConceptUtils::sameType( mySign, T::POS );
     ConceptUtils::sameType( mySign, T::NEG );
     ConceptUtils::sameType( myBool, myX.init( myP1, myP2, myBool ) );
+    checkContainerConstraints();
     checkConstConstraints();
   }
+  void checkContainerConstraints()
+  {
+    myBool = myCellSet.insert( myCell ).second;
+    myBool = mySCellSet.insert( mySCell ).second;
+    myBool = mySurfelSet.insert( mySCell ).second;
+    myBool = myCellSet.find( myCell ) != myCellSet.end();
+    myBool = mySCellSet.find( mySCell ) != mySCellSet.end();
+    myBool = mySurfelSet.find( mySCell ) != mySurfelSet.end();
+    myBool = myCellSet.count( myCell ) != 0;
+    myBool = mySCellSet.count( mySCell ) != 0;
+    myBool = mySurfelSet.count( mySCell ) != 0;
+    myBool = myCellSet.erase( myCell ) != 0;
+    myBool = mySCellSet.erase( mySCell ) != 0;
+    myBool = mySurfelSet.erase( mySCell ) != 0;
+    myCellMap[ myCell ] = myDummy;
+    mySCellMap[ mySCell ] = myDummy;
+    mySurfelMap[ mySCell ] = myDummy;
+    myBool = myCellMap.find( myCell ) != myCellMap.end();
+    myBool = mySCellMap.find( mySCell ) != mySCellMap.end();
+    myBool = mySurfelMap.find( mySCell ) != mySurfelMap.end();
+  }
   void checkConstConstraints() const
   {
     ConceptUtils::sameType( mySize, myX.size( myDim ) );
@@ -499,6 +530,13 @@ private:
   DirIterator myDirIt;
   Cells myCells;
   SCells mySCells;
+  CellSet myCellSet;
+  SCellSet mySCellSet;
+  SurfelSet mySurfelSet;
+  CellMap myCellMap;
+  SCellMap mySCellMap;
+  SurfelMap mySurfelMap;
+  Dummy myDummy;
 
     // ------------------------- Internals ------------------------------------
 private:
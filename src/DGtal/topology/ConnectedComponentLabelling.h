@@ -0,0 +1,309 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ConnectedComponentLabelling.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: Computes the connected components of an Object whose
+   * domain is a HyperRectDomain, with a union-find structure over the
+   * points of the domain instead of the breadth-first traversals of
+   * Object::writeComponents.
+   *
+   * The domain is scanned in its own order. Each point of the object
+   * is merged with its neighbors (in the sense of the foreground
+   * adjacency of the object topology) which precede it in the scan:
+   * the neighbors are given by constant offsets in the linearized
+   * domain, so that no set lookup is needed once the object has been
+   * rasterized. Trees are always rooted at their first point in the
+   * scan, so that a final linear pass numbers the components (from 1,
+   * 0 being the background) by order of their first point.
+   *
+   * The domain is cut into slabs along its last axis. If DGtal has
+   * been built with OpenMP support (WITH_OPENMP flag set to "true"),
+   * the slabs are scanned in parallel (each thread only links points
+   * of its slab), then the components are merged sequentially across
+   * the slab interfaces. The result does not depend on the number of
+   * threads.
+   *
+   * The foreground adjacency must be included in the
+   * \f$3^n-1\f$-neighborhood (e.g. MetricAdjacency or DomainAdjacency
+   * over a MetricAdjacency), and the domain must have less than
+   * \f$2^{32}-1\f$ points.
+   *
+   * @code
+   * typedef ConnectedComponentLabelling<Z3i::Object26_6> Labelling;
+   * Labelling labelling( object );
+   * Labelling::LabelImage labels = labelling.labelImage();
+   * std::vector<Z3i::Object26_6> components;
+   * std::back_insert_iterator< std::vector<Z3i::Object26_6> > it( components );
+   * labelling.writeComponents( it );
+   * @endcode
+   *
+   * @tparam TObject the type of object (an Object on a
+   * HyperRectDomain).
+   *
+   * @see Object::writeComponents, testConnectedComponentLabelling.cpp
+   */
+  template <typename TObject>
+  class ConnectedComponentLabelling
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TObject Object;
+    typedef typename Object::Domain Domain;
+    typedef typename Object::DigitalSet DigitalSet;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename Domain::Space Space;
+    typedef typename Space::Dimension Dimension;
+
+    /// Type of the component labels (0 is the background).
+    typedef DGtal::uint32_t Label;
+    /// Type of the label image.
+    typedef ImageContainerBySTLVector<Domain, Label> LabelImage;
+
+    /**
+     * Constructor. Computes the labelling of the object.
+     *
+     * @param anObject the object to label (aliased).
+     * @param isParallel if true (default), slabs are processed in
+     * parallel when DGtal has been built with OpenMP support.
+     */
+    ConnectedComponentLabelling( ConstAlias<Object> anObject,
+                                 const bool isParallel = true );
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponentLabelling();
+
+    /**
+     * @return the labelled object.
+     */
+    const Object & object() const;
+
+    /**
+     * @return the number of connected components.
+     */
+    Size nbComponents() const;
+
+    /**
+     * @param p any point of the domain.
+     * @return the label of the component of @a p (between 1 and
+     * nbComponents()), or 0 if @a p does not belong to the object.
+     */
+    Label label( const Point & p ) const;
+
+    /**
+     * @return an image on the object domain storing the label of
+     * each point (0 for the background).
+     */
+    LabelImage labelImage() const;
+
+    /**
+     * Writes the connected components of the object (by order of
+     * their labels) with the given output iterator. The components
+     * are CONNECTED objects sharing the topology of the object.
+     *
+     * @tparam OutputObjectIterator the type of an output iterator in
+     * a container of Object s.
+     * @param it the output iterator.
+     * @return the number of components.
+     */
+    template <typename OutputObjectIterator>
+    Size writeComponents( OutputObjectIterator & it ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The labelled object.
+    const Object * myObject;
+
+    /// Lower bound of the domain.
+    Point myLowerBound;
+
+    /// Upper bound of the domain.
+    Point myUpperBound;
+
+    /// Labels of the domain points, in the domain order.
+    std::vector<Label> myLabels;
+
+    /// Number of components.
+    Size myNbComponents;
+
+    /// Neighbor offsets preceding a point in the scan order.
+    std::vector<Point> myOffsets;
+
+    /// Linear offsets of myOffsets.
+    std::vector<std::ptrdiff_t> myLinearOffsets;
+
+    /// True if slabs may be processed in parallel.
+    bool myIsParallel;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    ConnectedComponentLabelling();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling ( const ConnectedComponentLabelling & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ConnectedComponentLabelling & operator= ( const ConnectedComponentLabelling & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p any point of the domain.
+     * @return the index of @a p in the domain order.
+     */
+    std::size_t linearIndex( const Point & p ) const;
+
+    /**
+     * @param i the index of a point in the domain order.
+     * @return the point of index @a i.
+     */
+    Point pointFromIndex( std::size_t i ) const;
+
+    /**
+     * Computes the offsets of the adjacent points which precede a
+     * point in the scan order.
+     */
+    void computeOffsets();
+
+    /**
+     * Links the points of the domain between the indices @a first and
+     * @a last (excluded) with their preceding neighbors of index
+     * greater or equal to @a bound.
+     *
+     * @param first the index of the first point to scan.
+     * @param last the index after the last point to scan.
+     * @param bound the lowest index of a neighbor to link with.
+     */
+    void scan( const std::size_t first, const std::size_t last,
+               const std::size_t bound );
+
+    /**
+     * @param i the index of a point of the object.
+     * @return the index of the root of its tree (with path halving).
+     */
+    std::size_t findRoot( std::size_t i );
+
+    /**
+     * Merges the trees of the points of indices @a i and @a j.
+     */
+    void merge( const std::size_t i, const std::size_t j );
+
+    /**
+     * Computes the labelling (called by the constructor).
+     */
+    void compute();
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConnectedComponentLabelling<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
@@ -0,0 +1,336 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HomotopicThinning.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module HomotopicThinning.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HomotopicThinning_RECURSES)
+#error Recursive header files inclusion detected in HomotopicThinning.h
+#else // defined(HomotopicThinning_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HomotopicThinning_RECURSES
+
+#if !defined HomotopicThinning_h
+/** Prevents repeated inclusion of headers. */
+#define HomotopicThinning_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/topology/SimplePointTable.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HomotopicThinning
+  /**
+   * Description of template class 'HomotopicThinning' <p>
+   * \brief Aim: Homotopic thinning of an Object, i.e. iterative
+   * removal of its simple points until none is left, in dimension 2
+   * or 3.
+   *
+   * Simple points are detected with a SimplePointTable. Removing
+   * simultaneously several simple points may change the topology,
+   * unless none of them lies in the neighborhood of another one. The
+   * candidates of each step are thus split into the \f$2^n\f$
+   * subfields of the grid (points whose coordinates have the same
+   * parities): the candidates of a subfield are tested in parallel
+   * (if DGtal has been built with OpenMP support) and removed
+   * together, then the next subfield is processed. The result is the
+   * same as the one of a sequential removal, and does not depend on
+   * the number of threads.
+   *
+   * Two strategies are provided:
+   *
+   * - thinDirectional() proceeds by directional subiterations: the
+   *   candidates of the subiteration of direction d are the points
+   *   whose neighbor along d is not in the object, so that the object
+   *   is peeled symmetrically. A last subiteration considers all the
+   *   border points, until stability.
+   *
+   * - thinByPriority( f ) removes the points by increasing value of f
+   *   (e.g. a DistanceTransformation, which gives a centered medial
+   *   skeleton): the points with the same priority are processed
+   *   together, and the neighbors of the removed points are queued
+   *   again.
+   *
+   * Curve skeletons are obtained by preserving the end points
+   * (points with exactly one neighbor in the object for the foreground
+   * adjacency), see setEndPointPreservation().
+   *
+   * The object is modified in place. The number of removed points and
+   * the time spent are accumulated over the calls (see nbRemoved(),
+   * time() and throughput()).
+   *
+   * @code
+   * typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+   * DT dt( &domain, &object.pointSet(), &l2 );
+   * HomotopicThinning<Z3i::Object26_6> thinning( object );
+   * thinning.setEndPointPreservation( true );
+   * thinning.thinByPriority( dt );
+   * trace.info() << thinning.throughput() << " points/s" << std::endl;
+   * @endcode
+   *
+   * @tparam TObject the type of object (see Object), whose digital
+   * topology is a valid parameter of SimplePointTable.
+   *
+   * @see Object::isSimple, SimplePointTable, testHomotopicThinning.cpp
+   */
+  template <typename TObject>
+  class HomotopicThinning
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TObject Object;
+    typedef typename Object::DigitalTopology DigitalTopology;
+    typedef typename Object::DigitalSet DigitalSet;
+    typedef typename Object::Point Point;
+    typedef typename Object::Size Size;
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename Point::Dimension Dimension;
+    typedef SimplePointTable<DigitalTopology> Table;
+    typedef typename Table::Configuration Configuration;
+
+    /**
+     * Constructor.
+     *
+     * @param anObject the object to thin (aliased, modified in place).
+     * @param isParallel if true (default), the candidates are tested
+     * in parallel when DGtal has been built with OpenMP support.
+     */
+    HomotopicThinning( Alias<Object> anObject,
+                       const bool isParallel = true );
+
+    /**
+     * Destructor.
+     */
+    ~HomotopicThinning();
+
+    /**
+     * @return the thinned object.
+     */
+    const Object & object() const;
+
+    /**
+     * @return the simple point table.
+     */
+    const Table & table() const;
+
+    /**
+     * @param isPreserved if true, the end points of the object are
+     * never removed (curve skeleton), otherwise (default) all the
+     * simple points are removed.
+     */
+    void setEndPointPreservation( const bool isPreserved );
+
+    /**
+     * @return 'true' if the end points are preserved.
+     */
+    bool preservesEndPoints() const;
+
+    /**
+     * Thins the object by directional subiterations, until no point
+     * can be removed.
+     *
+     * @return the number of removed points.
+     */
+    Size thinDirectional();
+
+    /**
+     * Thins the object by removing its points by increasing
+     * priority, until no point can be removed.
+     *
+     * @tparam TPriority a functor from Point to a value convertible
+     * to double (e.g. a DistanceTransformation or an image).
+     * @param aPriority the priority of the points of the object.
+     * @return the number of removed points.
+     */
+    template <typename TPriority>
+    Size thinByPriority( const TPriority & aPriority );
+
+    /**
+     * @param p any point.
+     * @return 'true' if @a p can be removed from the object (i.e. it
+     * is simple, and not an end point if they are preserved).
+     */
+    bool isRemovable( const Point & p ) const;
+
+    /**
+     * @return the number of points removed since the construction.
+     */
+    Size nbRemoved() const;
+
+    /**
+     * @return the number of processed steps (subiterations or
+     * priority levels) since the construction.
+     */
+    Size nbSteps() const;
+
+    /**
+     * @return the time (in ms) spent in thinning since the construction.
+     */
+    double time() const;
+
+    /**
+     * @return the number of removed points per second.
+     */
+    double throughput() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The thinned object.
+    Object* myObject;
+
+    /// The simple point table of the object topology.
+    Table myTable;
+
+    /// Neighbors foreground adjacent to the origin (end point test).
+    Configuration myKappaStart;
+
+    /// Configuration of a point whose neighbors are all in the object.
+    Configuration myFullConfiguration;
+
+    /// If true, candidates are tested in parallel.
+    bool myIsParallel;
+
+    /// If true, end points are not removed.
+    bool myPreserveEndPoints;
+
+    /// Number of removed points.
+    Size myNbRemoved;
+
+    /// Number of processed steps.
+    Size myNbSteps;
+
+    /// Time spent in thinning (ms).
+    double myTime;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    HomotopicThinning();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    HomotopicThinning ( const HomotopicThinning & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    HomotopicThinning & operator= ( const HomotopicThinning & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aSet the point set of the object.
+     * @param p any point.
+     * @return 'true' if @a p can be removed from @a aSet.
+     */
+    bool isRemovable( const DigitalSet & aSet, const Point & p ) const;
+
+    /**
+     * @param p any point.
+     * @return the index of the subfield of @a p (parities of its
+     * coordinates).
+     */
+    static unsigned int subfield( const Point & p );
+
+    /**
+     * Removes the removable candidates, subfield by subfield.
+     *
+     * @param aSet the point set of the object.
+     * @param candidates the candidates (points which are not in @a
+     * aSet are ignored).
+     * @param removed (returns) the removed points are appended.
+     * @return the number of removed points.
+     */
+    Size removeSimplePoints( DigitalSet & aSet,
+                             const std::vector<Point> & candidates,
+                             std::vector<Point> & removed );
+
+  }; // end of class HomotopicThinning
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HomotopicThinning'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HomotopicThinning' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TObject>
+  std::ostream&
+  operator<< ( std::ostream & out, const HomotopicThinning<TObject> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/HomotopicThinning.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HomotopicThinning_h
+
+#undef HomotopicThinning_RECURSES
+#endif // else defined(HomotopicThinning_RECURSES)
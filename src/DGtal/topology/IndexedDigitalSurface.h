@@ -0,0 +1,556 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedDigitalSurface.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IndexedDigitalSurface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in IndexedDigitalSurface.h
+#else // defined(IndexedDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedDigitalSurface_RECURSES
+
+#if !defined IndexedDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/UmbrellaComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedDigitalSurface
+  /**
+  Description of template class 'IndexedDigitalSurface' <p>
+
+  \brief Aim: Represents an immutable digital surface whose surfels
+  are numbered by dense integer indices, and whose vertex adjacency,
+  arcs and umbrella faces are precomputed and stored in compressed
+  sparse row (CSR) arrays.
+
+  DigitalSurface computes neighbors, arcs and faces on the fly with
+  its tracker and its UmbrellaComputer, which is repeated work when
+  several algorithms traverse the same surface. IndexedDigitalSurface
+  does this work once, at construction, and then answers all these
+  queries by array look-ups:
+
+  - vertices are the surfels of the container, numbered from 0 to
+    size()-1 in the order of the container range;
+  - the arcs leaving vertex \a v are numbered from arcsBegin(v) to
+    arcsEnd(v)-1, in the order of DigitalSurface::outArcs, so that
+    the neighbors of \a v are the heads of these arcs;
+  - each arc has its opposite arc and, starting from 3D, its n-2
+    incident faces, in the order of DigitalSurface::facesAroundArc;
+  - faces are numbered in the order of DigitalSurface::allFaces and
+    store their vertices in the order of
+    DigitalSurface::verticesAroundFace.
+
+  Vertex, arc and face indices may be used to store data in plain
+  arrays (see IndexedProperty) instead of maps of surfels.
+
+  The construction processes the vertices and the arcs in parallel
+  when OpenMP is enabled (WITH_OPENMP). The const methods of the
+  container (trackers, predicates) must then be thread-safe, which is
+  the case of the containers of DGtal. Faces are computed only when
+  the cellular grid space is closed (umbrellas require closed spaces)
+  and when its dimension is at least 3.
+
+  IndexedDigitalSurface is a model of the concept
+  CUndirectedSimpleGraph, CUndirectedSimpleLocalGraph,
+  CConstSinglePassRange (its range is actually multi-pass),
+  boost::CopyConstructible, boost::Assignable.
+
+  @tparam TDigitalSurfaceContainer any model of
+  CDigitalSurfaceContainer: the representation of the digital surface
+  which is indexed.
+
+  @see DigitalSurface, UmbrellaComputer
+   */
+  template <typename TDigitalSurfaceContainer>
+  class IndexedDigitalSurface
+  {
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    BOOST_CONCEPT_ASSERT(( CDigitalSurfaceContainer<DigitalSurfaceContainer> ));
+
+    // ----------------------- types ------------------------------
+  public:
+    typedef IndexedDigitalSurface<DigitalSurfaceContainer> Self;
+    typedef typename DigitalSurfaceContainer::KSpace KSpace;
+    typedef typename DigitalSurfaceContainer::Cell Cell;
+    typedef typename DigitalSurfaceContainer::SCell SCell;
+    typedef typename DigitalSurfaceContainer::Surfel Surfel;
+    typedef typename DigitalSurfaceContainer::DigitalSurfaceTracker DigitalSurfaceTracker;
+    typedef typename KSpace::Point Point;
+
+    /// Type of the vertex, arc and face indices.
+    typedef DGtal::uint32_t Index;
+    /// Type of the ranges of indices.
+    typedef std::vector<Index> IndexRange;
+    /// Iterator on indices.
+    typedef typename IndexRange::const_iterator IndexConstIterator;
+    /// Template rebinding for defining the type of an array of values
+    /// indexed by the vertex, arc or face indices.
+    template <typename Value> struct IndexedProperty {
+      typedef std::vector<Value> Type;
+    };
+
+    // ----------------------- UndirectedSimpleGraph --------------------------
+  public:
+    /// Defines the type for a vertex.
+    typedef Surfel Vertex;
+    /// Defines how to represent a size (unsigned integral type).
+    typedef typename KSpace::Size Size;
+    /// Defines how to represent a set of vertex.
+    typedef typename KSpace::SurfelSet VertexSet;
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct VertexMap {
+      typedef typename KSpace::template SurfelMap<Value>::Type Type;
+    };
+    /// The vertices are stored in a vector.
+    typedef typename std::vector<Vertex>::const_iterator ConstIterator;
+    /// The edges are the ones of DigitalSurface.
+    typedef typename DigitalSurface<DigitalSurfaceContainer>::Edge Edge;
+
+    // ----------------------- CombinatorialSurface --------------------------
+  public:
+    /// This define a utility class for computing umbrellas.
+    typedef UmbrellaComputer<DigitalSurfaceTracker> Umbrella;
+    /// The state of an umbrella.
+    typedef typename Umbrella::State UmbrellaState;
+    /// An arc, as defined by DigitalSurface.
+    typedef typename DigitalSurface<DigitalSurfaceContainer>::Arc Arc;
+    /// A face, as defined by DigitalSurface.
+    typedef typename DigitalSurface<DigitalSurfaceContainer>::Face Face;
+
+    /// The value of an index that does not correspond to anything.
+    static const Index INVALID_INDEX = 0xffffffff;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~IndexedDigitalSurface();
+
+    /**
+       Constructor from a container. Indexes all its surfels, their
+       adjacencies, arcs and faces. The container is not referenced
+       afterwards.
+
+       @param aContainer any digital surface container.
+    */
+    IndexedDigitalSurface( const DigitalSurfaceContainer & aContainer );
+
+    /**
+       Constructor from a digital surface. Indexes all its surfels,
+       their adjacencies, arcs and faces. The surface is not
+       referenced afterwards.
+
+       @param aSurface any digital surface.
+    */
+    IndexedDigitalSurface( const DigitalSurface<DigitalSurfaceContainer> & aSurface );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    IndexedDigitalSurface ( const IndexedDigitalSurface & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    IndexedDigitalSurface & operator= ( const IndexedDigitalSurface & other );
+
+    /**
+       @return a const reference to the cellular grid space.
+    */
+    const KSpace & space() const;
+
+    // ----------------- UndirectedSimpleGraph realization --------------------
+  public:
+
+    /**
+       @return a ConstIterator on the first vertex (of index 0).
+    */
+    ConstIterator begin() const;
+
+    /**
+       @return a ConstIterator after the last vertex.
+    */
+    ConstIterator end() const;
+
+    /// @return the number of vertices of the graph.
+    Size size() const;
+
+    /**
+       @return 2*(K::dimension-1)
+    */
+    Size bestCapacity() const;
+
+    /**
+       @param v any vertex of this graph
+       @return the number of neighbors of this vertex.
+    */
+    Size degree( const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of [v] in the output iterator [it], in the
+       order of DigitalSurface::writeNeighbors.
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @param[in,out] it any output iterator on Vertex (*it++ should
+       be allowed), which specifies where neighbors are written.
+
+       @param[in] v any vertex of this graph
+    */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & it,
+                         const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of [v], verifying the predicate [pred] in
+       the output iterator [it].
+
+       @tparam OutputIterator the type for the output iterator
+       (e.g. back_insert_iterator<std::vector<Vertex> >).
+
+       @tparam VertexPredicate any type of predicate taking a Vertex as input.
+
+       @param[in,out] it any output iterator on Vertex (*it++ should
+       be allowed), which specifies where neighbors are written.
+
+       @param[in] v any vertex of this graph
+
+       @param[in] pred the predicate for selecting neighbors.
+    */
+    template <typename OutputIterator, typename VertexPredicate>
+    void writeNeighbors( OutputIterator & it,
+                         const Vertex & v,
+                         const VertexPredicate & pred ) const;
+
+    // ----------------------- Vertex indices ---------------------------------
+  public:
+
+    /**
+       @param v any surfel.
+       @return the index of [v], or INVALID_INDEX if [v] is not a
+       vertex of this surface.
+    */
+    Index index( const Vertex & v ) const;
+
+    /**
+       @param v any vertex index.
+       @return the vertex of index [v].
+    */
+    const Vertex & vertex( Index v ) const;
+
+    /**
+       @param v any vertex index.
+       @return the number of neighbors of vertex [v].
+    */
+    Size degree( Index v ) const;
+
+    /**
+       @param v any vertex index.
+       @return an iterator on the index of the first neighbor of [v].
+    */
+    IndexConstIterator neighborsBegin( Index v ) const;
+
+    /**
+       @param v any vertex index.
+       @return an iterator after the index of the last neighbor of [v].
+    */
+    IndexConstIterator neighborsEnd( Index v ) const;
+
+    // ----------------------- Arc indices ------------------------------------
+  public:
+
+    /// @return the number of arcs (twice the number of edges).
+    Size nbArcs() const;
+
+    /**
+       @param v any vertex index.
+       @return the index of the first arc leaving [v].
+    */
+    Index arcsBegin( Index v ) const;
+
+    /**
+       @param v any vertex index.
+       @return the index after the last arc leaving [v].
+    */
+    Index arcsEnd( Index v ) const;
+
+    /**
+       @param a any arc index.
+       @return the index of the vertex at the tail of [a].
+    */
+    Index tail( Index a ) const;
+
+    /**
+       @param a any arc index.
+       @return the index of the vertex at the head of [a].
+    */
+    Index head( Index a ) const;
+
+    /**
+       @param a any arc index (s,t).
+       @return the index of the arc (t,s), or INVALID_INDEX if it does
+       not exist (open surfaces).
+    */
+    Index opposite( Index a ) const;
+
+    /**
+       @param a any arc index.
+       @return the arc of index [a].
+    */
+    Arc arc( Index a ) const;
+
+    /**
+       @param a any arc.
+       @return the index of [a], or INVALID_INDEX if [a] is not an arc
+       of this surface.
+    */
+    Index index( const Arc & a ) const;
+
+    // ----------------------- Face indices -----------------------------------
+  public:
+
+    /// @return the number of faces (open and closed).
+    Size nbFaces() const;
+
+    /**
+       @return the number of faces incident to each arc: n-2 when
+       faces are computed, 0 otherwise.
+    */
+    Dimension nbFacesPerArc() const;
+
+    /**
+       @param a any arc index.
+       @return an iterator on the index of the first face incident to
+       [a], in the order of DigitalSurface::facesAroundArc.
+    */
+    IndexConstIterator facesAroundArcBegin( Index a ) const;
+
+    /**
+       @param a any arc index.
+       @return an iterator after the index of the last face incident to [a].
+    */
+    IndexConstIterator facesAroundArcEnd( Index a ) const;
+
+    /**
+       @param v any vertex index.
+       @return the indices of the faces containing [v], in the order
+       of DigitalSurface::facesAroundVertex.
+    */
+    IndexRange facesAroundVertex( Index v ) const;
+
+    /**
+       @param f any face index.
+       @return the face of index [f].
+    */
+    Face face( Index f ) const;
+
+    /**
+       @param f any face index.
+       @return 'true' if the face [f] is closed.
+    */
+    bool isClosed( Index f ) const;
+
+    /**
+       @param f any face index.
+       @return an iterator on the index of the first vertex of [f], in
+       the order of DigitalSurface::verticesAroundFace.
+    */
+    IndexConstIterator verticesAroundFaceBegin( Index f ) const;
+
+    /**
+       @param f any face index.
+       @return an iterator after the index of the last vertex of [f].
+    */
+    IndexConstIterator verticesAroundFaceEnd( Index f ) const;
+
+    // ----------------------- Indexed properties -----------------------------
+  public:
+
+    /**
+       @tparam Value the type of the property values.
+       @param value the initial value of the property.
+       @return an array of values indexed by the vertex indices.
+    */
+    template <typename Value>
+    typename IndexedProperty<Value>::Type
+    makeVertexProperty( const Value & value = Value() ) const;
+
+    /**
+       @tparam Value the type of the property values.
+       @param value the initial value of the property.
+       @return an array of values indexed by the arc indices.
+    */
+    template <typename Value>
+    typename IndexedProperty<Value>::Type
+    makeArcProperty( const Value & value = Value() ) const;
+
+    /**
+       @tparam Value the type of the property values.
+       @param value the initial value of the property.
+       @return an array of values indexed by the face indices.
+    */
+    template <typename Value>
+    typename IndexedProperty<Value>::Type
+    makeFaceProperty( const Value & value = Value() ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The cellular grid space.
+    KSpace mySpace;
+    /// The vertices, by index.
+    std::vector<Vertex> myVertices;
+    /// The vertex indices.
+    typename VertexMap<Index>::Type myIndices;
+    /// CSR offsets of the arcs leaving each vertex (size()+1 values).
+    IndexRange myArcOffsets;
+    /// The tail vertex of each arc.
+    IndexRange myTails;
+    /// The head vertex of each arc (CSR adjacency).
+    IndexRange myHeads;
+    /// The opposite of each arc.
+    IndexRange myOpposites;
+    /// The direction toward the head of each arc.
+    std::vector<unsigned char> myArcDirections;
+    /// The orientation toward the head of each arc.
+    std::vector<bool> myArcOrientations;
+    /// The number of faces incident to each arc (n-2 or 0).
+    Dimension myNbFacesPerArc;
+    /// The faces incident to each arc (nbFacesPerArc() per arc).
+    IndexRange myArcFaces;
+    /// The representative state of each face.
+    std::vector<UmbrellaState> myFaceStates;
+    /// Tells for each face if it is closed.
+    std::vector<bool> myFaceClosed;
+    /// CSR offsets of the vertices of each face (nbFaces()+1 values).
+    IndexRange myFaceOffsets;
+    /// The vertices of each face.
+    IndexRange myFaceVertices;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    IndexedDigitalSurface();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Builds all the indexed data from a container.
+       @param aContainer any digital surface container.
+    */
+    void build( const DigitalSurfaceContainer & aContainer );
+
+    /**
+       Builds the vertex adjacencies and the arcs.
+       @param aContainer the indexed container.
+    */
+    void buildArcs( const DigitalSurfaceContainer & aContainer );
+
+    /**
+       Builds the faces.
+       @param aContainer the indexed container.
+    */
+    void buildFaces( const DigitalSurfaceContainer & aContainer );
+
+    /**
+       Same as DigitalSurface::computeFace with a given umbrella
+       computer.
+
+       @param umbrella an umbrella computer over the surface.
+       @param state any valid state on the surface.
+       @return the face that contains the given [state].
+    */
+    static Face computeFace( Umbrella & umbrella, UmbrellaState state );
+
+  }; // end of class IndexedDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IndexedDigitalSurface<TDigitalSurfaceContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/IndexedDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedDigitalSurface_h
+
+#undef IndexedDigitalSurface_RECURSES
+#endif // else defined(IndexedDigitalSurface_RECURSES)
@@ -43,6 +43,8 @@
 #include <iostream>
 #include <set>
 #include <map>
+#include <boost/unordered_set.hpp>
+#include <boost/unordered_map.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/PointVector.h"
@@ -311,6 +313,96 @@ namespace DGtal
   };
 
 
+  /**
+     @brief Hash functor for (signed or unsigned) Khalimsky cells.
+
+     The Khalimsky coordinates are packed in a 64-bit integer, each
+     one in a field of (64 / dim) bits, and the result is mixed with
+     the splitmix64 finalizer. The packing is injective as long as the
+     coordinates fit in their fields (e.g. 21 bits per coordinate in
+     3D), which is the case for the bounded spaces that are used in
+     practice. The functor is stateless, so that any number of hashed
+     containers of cells may share it.
+
+     @tparam dim the dimension of the cells.
+     @tparam TInteger the integer type of the cell coordinates.
+  */
+  template < Dimension dim,
+             typename TInteger = DGtal::int32_t >
+  struct KhalimskyCellHash
+  {
+    typedef TInteger Integer;
+    typedef KhalimskyCell< dim, Integer > Cell;
+    typedef SignedKhalimskyCell< dim, Integer > SCell;
+
+    /**
+     * @param c any unsigned cell.
+     * @return the hash value of the cell [c].
+     */
+    std::size_t operator()( const Cell & c ) const;
+
+    /**
+     * @param c any signed cell.
+     * @return the hash value of the signed cell [c].
+     */
+    std::size_t operator()( const SCell & c ) const;
+
+    /**
+     * @param kp the Khalimsky coordinates of a cell.
+     * @return the coordinates packed in a 64-bit integer.
+     */
+    static DGtal::uint64_t pack( const PointVector< dim, Integer > & kp );
+
+    /**
+     * @param h any 64-bit integer.
+     * @return the bits of [h] mixed by the splitmix64 finalizer.
+     */
+    static DGtal::uint64_t mix( DGtal::uint64_t h );
+  };
+
+  /**
+     @brief Cell container policy of KhalimskySpaceND that defines
+     the sets and maps of cells as ordered containers (std::set and
+     std::map). This is the default policy.
+  */
+  struct KhalimskyOrderedContainers
+  {
+    /// Template rebinding for the type of a set of cells of type TCell.
+    template <typename TCell> struct Set {
+      typedef std::set<TCell> Type;
+    };
+    /// Template rebinding for the type of a mapping TCell -> TValue.
+    template <typename TCell, typename TValue> struct Map {
+      typedef std::map<TCell,TValue> Type;
+    };
+  };
+
+  /**
+     @brief Cell container policy of KhalimskySpaceND that defines
+     the sets and maps of cells as hashed containers
+     (boost::unordered_set and boost::unordered_map with
+     KhalimskyCellHash).
+
+     Insertions and look-ups take constant time instead of logarithmic
+     time, but the cells are not enumerated in lexicographic order.
+  */
+  struct KhalimskyHashContainers
+  {
+    /// Template rebinding for the type of a set of cells of type TCell.
+    template <typename TCell> struct Set {
+      typedef boost::unordered_set
+      < TCell, KhalimskyCellHash< TCell::Point::dimension,
+                                  typename TCell::Integer > > Type;
+    };
+    /// Template rebinding for the type of a mapping TCell -> TValue.
+    template <typename TCell, typename TValue> struct Map {
+      typedef boost::unordered_map
+      < TCell, TValue, KhalimskyCellHash< TCell::Point::dimension,
+                                          typename TCell::Integer > > Type;
+    };
+  };
+
+
   /////////////////////////////////////////////////////////////////////////////
   // template class KhalimskySpaceND
   /**
@@ -326,12 +418,21 @@ namespace DGtal
    * integers). The user should choose between a closed (default) cell
    * space or an open cell space.
    *
+   * When the space is bounded and small enough, each cell has a
+   * packed 64-bit key (see uKey() and sKey()), which is the index of
+   * the cell in the box of Khalimsky coordinates of the space.
+   *
    * @tparam dim the dimension of the digital space.
    * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   * @tparam TCellContainers the policy that defines the sets and maps
+   * of cells (CellSet, SCellSet, SurfelSet, CellMap, SCellMap,
+   * SurfelMap), either KhalimskyOrderedContainers (default) or
+   * KhalimskyHashContainers.
    * NB: Essentially a backport from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene).
   */
   template < Dimension dim,
-             typename TInteger = DGtal::int32_t >
+             typename TInteger = DGtal::int32_t,
+             typename TCellContainers = KhalimskyOrderedContainers >
   class KhalimskySpaceND
   {
     //Integer must be signed to characterize a ring.
@@ -356,7 +457,8 @@ namespace DGtal
     typedef PointVector< dim, Integer > Vector;
 
     typedef SpaceND<dim, Integer> Space;
-    typedef KhalimskySpaceND<dim, Integer> KhalimskySpace;
+    typedef KhalimskySpaceND<dim, Integer, TCellContainers> KhalimskySpace;
+    typedef TCellContainers CellContainers;
 
 #if defined ( WIN32 )
     // static constants
@@ -386,26 +488,29 @@ namespace DGtal
 
     // Sets, Maps
     /// Preferred type for defining a set of Cell(s).
-    typedef std::set<Cell> CellSet;
+    typedef typename TCellContainers::template Set<Cell>::Type CellSet;
     /// Preferred type for defining a set of SCell(s).
-    typedef std::set<SCell> SCellSet;
+    typedef typename TCellContainers::template Set<SCell>::Type SCellSet;
     /// Preferred type for defining a set of surfels (always signed cells).
-    typedef std::set<SCell> SurfelSet;
+    typedef typename TCellContainers::template Set<SCell>::Type SurfelSet;
     /// Template rebinding for defining the type that is a mapping
     /// Cell -> Value.
     template <typename Value> struct CellMap {
-      typedef std::map<SCell,Value> Type;
+      typedef typename TCellContainers::template Map<Cell,Value>::Type Type;
     };
     /// Template rebinding for defining the type that is a mapping
     /// SCell -> Value.
     template <typename Value> struct SCellMap {
-      typedef std::map<SCell,Value> Type;
+      typedef typename TCellContainers::template Map<SCell,Value>::Type Type;
     };
     /// Template rebinding for defining the type that is a mapping
     /// SCell -> Value.
     template <typename Value> struct SurfelMap {
-      typedef std::map<SCell,Value> Type;
+      typedef typename TCellContainers::template Map<SCell,Value>::Type Type;
     };
+
+    /// Type of the packed keys of the cells (see uKey() and sKey()).
+    typedef DGtal::uint64_t CellKey;
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -441,7 +546,8 @@ namespace DGtal
      * @param closed 'true' if this space is closed, 'false' if open.
      *
      * @return true if the initialization was valid (ie, such bounds
-     * are representable with these integers).
+     * are representable with these integers). Otherwise, the space
+     * is left unchanged.
      */
     bool init( const Point & lower,
                const Point & upper,
@@ -730,6 +836,47 @@ namespace DGtal
      */
     SCell sOpp( const SCell & p ) const;
 
+    // ----------------------- Packed cell keys ------------------------------
+  public:
+
+    /**
+     * @return 'true' if the cells of this space have packed keys,
+     * i.e. if twice the number of cells of the space fits in a
+     * CellKey. Otherwise, uKey(), uCellFromKey(), sKey() and
+     * sCellFromKey() must not be used.
+     */
+    bool hasCellKeys() const;
+
+    /**
+     * @param c any unsigned cell of this space.
+     * @return the packed key of [c], which is the index of [c] in the
+     * box of Khalimsky coordinates of the space.
+     * @pre hasCellKeys()
+     */
+    CellKey uKey( const Cell & c ) const;
+
+    /**
+     * @param key the packed key of an unsigned cell of this space.
+     * @return the unsigned cell whose key is [key].
+     * @pre hasCellKeys()
+     */
+    Cell uCellFromKey( CellKey key ) const;
+
+    /**
+     * @param c any signed cell of this space.
+     * @return the packed key of [c], which is twice the key of its
+     * unsigned cell, plus one if [c] is positive.
+     * @pre hasCellKeys()
+     */
+    CellKey sKey( const SCell & c ) const;
+
+    /**
+     * @param key the packed key of a signed cell of this space.
+     * @return the signed cell whose key is [key].
+     * @pre hasCellKeys()
+     */
+    SCell sCellFromKey( CellKey key ) const;
+
     // ------------------------- Cell topology services -----------------------
   public:
     /**
@@ -1457,6 +1604,10 @@ namespace DGtal
     Cell myCellLower;
     Cell myCellUpper;
     bool myIsClosed;
+    /// Strides of the Khalimsky coordinates in the packed keys.
+    CellKey myKeyStrides[ dim ];
+    /// 'true' if the cells have packed keys.
+    bool myHasCellKeys;
     // ------------------------- Hidden services ------------------------------
   protected:
 
@@ -1488,10 +1639,11 @@ namespace DGtal
    * @return the output stream after the writing.
    */
   template < Dimension dim,
-             typename TInteger >
+             typename TInteger,
+             typename TCellContainers >
   std::ostream&
   operator<< ( std::ostream & out,
-               const KhalimskySpaceND<dim, TInteger > & object );
+               const KhalimskySpaceND<dim, TInteger, TCellContainers > & object );
 
 } // namespace DGtal
 
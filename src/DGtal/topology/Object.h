@@ -52,6 +52,7 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/SimplePointTable.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -87,6 +88,8 @@ namespace DGtal
    *
    *  @see testObject.cpp
    *  @see testObject-benchmark.cpp
+   *  @see ConnectedComponentLabelling for a faster computation of the
+   *  components of objects over a HyperRectDomain.
    */
   template <typename TDigitalTopology, typename TDigitalSet>
   class Object
@@ -318,6 +321,12 @@ namespace DGtal
        * which is lambda()-adjacent with some point of the background).
        *
        * NB : the background adjacency should be a symmetric relation.
+       *
+       * If the point set is a DigitalSetByBitVector, the border is
+       * computed word by word as the set minus its erosion (the
+       * intersection of its translations by the neighbors of a
+       * point), the adjacency being then assumed to be invariant by
+       * translation (e.g. MetricAdjacency).
        */
       Object border() const;
 
@@ -477,6 +486,19 @@ namespace DGtal
        */
       bool isSimple( const Point & v ) const;
 
+      /**
+       * Same answer as isSimple( v ), read from the configuration of
+       * the neighborhood of [v] in the given table (no geodesic
+       * neighborhood is built).
+       *
+       * @param v any point.
+       * @param aTable a table built for the topology of this object.
+       * @return 'true' if this point is simple.
+       * @see SimplePointTable
+       */
+      bool isSimple( const Point & v,
+                     const SimplePointTable<DigitalTopology> & aTable ) const;
+
       // ----------------------- Interface --------------------------------------
     public:
 
@@ -517,6 +539,24 @@ namespace DGtal
     protected:
 
     private:
+
+      /**
+       * Computes the border of a point set point by point.
+       * @param aSet the point set of this object.
+       * @param outputSet (returns) the border of [aSet], initially empty.
+       */
+      template <typename TSet>
+      void computeBorder( const TSet & aSet, TSet & outputSet ) const;
+
+      /**
+       * Computes the border of a bit vector set word by word, as the
+       * set minus its erosion.
+       * @param aSet the point set of this object.
+       * @param outputSet (returns) the border of [aSet], initially empty.
+       */
+      template <typename TDomain>
+      void computeBorder( const DigitalSetByBitVector<TDomain> & aSet,
+                          DigitalSetByBitVector<TDomain> & outputSet ) const;
     
 
     
@@ -0,0 +1,267 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SimplePointTable.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SimplePointTable.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SimplePointTable_RECURSES)
+#error Recursive header files inclusion detected in SimplePointTable.h
+#else // defined(SimplePointTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SimplePointTable_RECURSES
+
+#if !defined SimplePointTable_h
+/** Prevents repeated inclusion of headers. */
+#define SimplePointTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/topology/DigitalTopologyTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SimplePointTable
+  /**
+   * Description of template class 'SimplePointTable' <p>
+   * \brief Aim: Table-driven simple point test for a digital topology
+   * in dimension 2 or 3.
+   *
+   * The configuration of a point p in a set X is the bitmask of the
+   * points of X in the \f$3^n-1\f$ neighborhood of p (bit i is set if
+   * p + offset(i) belongs to X, offsets being enumerated in the order
+   * of the 3x3 or 3x3x3 domain, first coordinate varying first,
+   * without the origin). The simplicity of p only depends on its
+   * configuration: it follows the same definition as
+   * Object::isSimple (geodesic neighborhoods of orders given by
+   * DigitalTopologyTraits, whose kappa-connectedness and
+   * lambda-connectedness in the complement are checked), but it is
+   * evaluated with a few bitwise operations on the configuration
+   * instead of building Object s.
+   *
+   * Moreover, the answers for all the configurations can be
+   * precomputed in a bit table (32 bytes in 2D, 8MB in 3D). This is
+   * done at construction in 2D, and on demand (precompute()) in 3D
+   * since it evaluates the \f$2^{26}\f$ configurations (in parallel
+   * if DGtal has been built with OpenMP support).
+   *
+   * @code
+   * SimplePointTable<Z3i::DT26_6> table( Z3i::dt26_6 );
+   * bool simple = table.isSimple( object.pointSet(), p );
+   * // same as object.isSimple( p, table ) or object.isSimple( p )
+   * @endcode
+   *
+   * @tparam TDigitalTopology a DigitalTopology whose adjacencies are
+   * MetricAdjacency (e.g. Z2i::DT4_8, Z2i::DT8_4, Z3i::DT6_18,
+   * Z3i::DT18_6, Z3i::DT6_26, Z3i::DT26_6).
+   *
+   * @see Object::isSimple
+   */
+  template <typename TDigitalTopology>
+  class SimplePointTable
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    typedef TDigitalTopology DigitalTopology;
+    typedef typename DigitalTopology::ForegroundAdjacency ForegroundAdjacency;
+    typedef typename DigitalTopology::BackgroundAdjacency BackgroundAdjacency;
+    typedef typename DigitalTopology::Point Point;
+    typedef typename ForegroundAdjacency::Space Space;
+
+    /// Bitmask of a 3^n-1 neighborhood.
+    typedef DGtal::uint32_t Configuration;
+
+    BOOST_STATIC_ASSERT(( Space::dimension >= 2 ));
+    BOOST_STATIC_ASSERT(( Space::dimension <= 3 ));
+
+    /**
+     * Constructor.
+     *
+     * @param aTopology the digital topology.
+     * @param precomputeTable if true, the answers of all the
+     * configurations are computed at construction (default in 2D).
+     */
+    SimplePointTable( const DigitalTopology & aTopology,
+                      const bool precomputeTable = ( Space::dimension == 2 ) );
+
+    /**
+     * Destructor.
+     */
+    ~SimplePointTable();
+
+    /**
+     * Computes the answers of all the configurations (if not already
+     * done).
+     */
+    void precompute();
+
+    /**
+     * @return 'true' if the answers of all the configurations are
+     * stored.
+     */
+    bool isPrecomputed() const;
+
+    /**
+     * @return the number of points of the neighborhood (8 or 26).
+     */
+    unsigned int size() const;
+
+    /**
+     * @param i the index of a neighbor (less than size()).
+     * @return the offset of the neighbor of index @a i.
+     */
+    const Point & offset( const unsigned int i ) const;
+
+    /**
+     * @param aSet any point predicate (e.g. a digital set).
+     * @param p any point.
+     * @return the configuration of @a p in @a aSet.
+     */
+    template <typename TPointPredicate>
+    Configuration configuration( const TPointPredicate & aSet,
+                                 const Point & p ) const;
+
+    /**
+     * @param aConfiguration the configuration of a point.
+     * @return 'true' if the point is simple.
+     */
+    bool isSimple( const Configuration aConfiguration ) const;
+
+    /**
+     * @param aSet any point predicate (e.g. a digital set).
+     * @param p any point.
+     * @return 'true' if @a p is simple for @a aSet.
+     */
+    template <typename TPointPredicate>
+    bool isSimple( const TPointPredicate & aSet, const Point & p ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Offsets of the neighbors.
+    std::vector<Point> myOffsets;
+
+    /// Foreground adjacencies between the neighbors.
+    std::vector<Configuration> myKappaMasks;
+
+    /// Background adjacencies between the neighbors.
+    std::vector<Configuration> myLambdaMasks;
+
+    /// Neighbors foreground adjacent to the origin.
+    Configuration myKappaStart;
+
+    /// Neighbors background adjacent to the origin.
+    Configuration myLambdaStart;
+
+    /// Order of the foreground geodesic neighborhood.
+    unsigned int myKappaOrder;
+
+    /// Order of the background geodesic neighborhood.
+    unsigned int myLambdaOrder;
+
+    /// Answers of all the configurations (empty if not precomputed).
+    std::vector<DGtal::uint64_t> myTable;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    SimplePointTable();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aSet the bitmask of a set of neighbors.
+     * @param masks the adjacencies between the neighbors.
+     * @param start the neighbors adjacent to the origin.
+     * @param order the order of the geodesic neighborhood.
+     * @return 'true' if the geodesic neighborhood of the origin in @a
+     * aSet is not empty and connected.
+     */
+    static bool isConnectedNeighborhood( const Configuration aSet,
+                                         const std::vector<Configuration> & masks,
+                                         const Configuration start,
+                                         const unsigned int order );
+
+    /**
+     * @param aConfiguration the configuration of a point.
+     * @return 'true' if the point is simple (without the table).
+     */
+    bool computeSimple( const Configuration aConfiguration ) const;
+
+  }; // end of class SimplePointTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SimplePointTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SimplePointTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalTopology>
+  std::ostream&
+  operator<< ( std::ostream & out, const SimplePointTable<TDigitalTopology> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SimplePointTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SimplePointTable_h
+
+#undef SimplePointTable_RECURSES
+#endif // else defined(SimplePointTable_RECURSES)
@@ -224,6 +224,82 @@ namespace DGtal
             const PointPredicate & pp,
             const SCell & start_surfel );
 
+    /**
+       Parallel version of trackBoundary, which extracts the same set
+       of surfels.
+
+       The tracking proceeds by breadth-first levels: the adjacent
+       surfels of all the surfels of the current level are computed
+       in parallel (if DGtal has been built with OpenMP support and
+       the level is big enough), then the new ones are inserted in
+       [surface] and form the next level. The predicate [pp] is thus
+       evaluated concurrently and should be thread-safe for reading
+       (e.g. a digital set or an image that is not modified).
+       
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+       
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape,
+       which should be at least partially included in the bounds of
+       space [K].
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @see trackBoundary
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static 
+    void parallelTrackBoundary( SCellSet & surface,
+                                const KSpace & K,
+                                const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                const PointPredicate & pp,
+                                const SCell & start_surfel );
+
+    /**
+       Parallel version of trackClosedBoundary, which extracts the
+       same set of surfels (see parallelTrackBoundary). As
+       trackClosedBoundary, it requires the object to be fully inside
+       the space.
+       
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+       
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+       
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+
+       @param pp an instance of a model of CPointPredicate, thread-safe
+       for reading.
+
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @see trackClosedBoundary
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static 
+    void parallelTrackClosedBoundary( SCellSet & surface,
+                                      const KSpace & K,
+                                      const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                                      const PointPredicate & pp,
+                                      const SCell & start_surfel );
+
 
     /**
        Function that extracts a n-1 digital surface (specified by a
@@ -834,6 +910,39 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Breadth-first tracking by levels, the adjacent surfels of a
+       level being computed in parallel.
+
+       @param surface (modified) the tracked set of surfels.
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of CPointPredicate.
+       @param start_surfel the first surfel.
+       @param closed when 'true', only direct orientations are
+       followed (as in trackClosedBoundary), otherwise both (as in
+       trackBoundary).
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static 
+    void parallelTrack( SCellSet & surface,
+                        const KSpace & K,
+                        const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                        const PointPredicate & pp,
+                        const SCell & start_surfel,
+                        const bool closed );
+
+    /**
+       @param K any space.
+       @param c any signed cell.
+       @param nbShards the number of shards.
+       @return the shard of [c] (a hash of its coordinates modulo
+       [nbShards]).
+    */
+    static
+    unsigned int shard( const KSpace & K, const SCell & c,
+                        const unsigned int nbShards );
+
   }; // end of class Surfaces
 
 
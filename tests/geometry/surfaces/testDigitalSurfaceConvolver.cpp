@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceConvolver.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DigitalSurfaceConvolver: the evaluation
+ * of a range of surfels (with masks, sequentially or by chunks in
+ * parallel when OpenMP is enabled) gives the same results as
+ * independent evaluations on the full kernel.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/FunctorOnCells.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantGaussianCurvatureEstimator.h"
+#include "DGtal/kernel/BasicPointFunctors.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfaceConvolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Evaluates an estimator on a range of surfels sequentially, then by
+ * small chunks (in parallel with OpenMP), then on each surfel
+ * independently, and counts the identical results.
+ *
+ * @return the number of surfels whose three results are identical.
+ */
+template< typename Estimator, typename SurfelIterator >
+unsigned int compareRangeAndSingleEvaluations( Estimator & estimator,
+                                               const SurfelIterator & ibegin,
+                                               const SurfelIterator & iend,
+                                               unsigned int & nbSurfels )
+{
+  typedef typename Estimator::Quantity Quantity;
+
+  std::vector< Quantity > results;
+  std::back_insert_iterator< std::vector< Quantity > > resultsIt( results );
+  trace.beginBlock( "Range evaluation" );
+  estimator.setChunkSize( 0 );
+  estimator.eval( ibegin, iend, resultsIt );
+  trace.endBlock();
+
+  std::vector< Quantity > chunkResults;
+  std::back_insert_iterator< std::vector< Quantity > > chunkResultsIt( chunkResults );
+  trace.beginBlock( "Range evaluation by chunks of 7 surfels" );
+  estimator.setChunkSize( 7 );
+  estimator.eval( ibegin, iend, chunkResultsIt );
+  trace.endBlock();
+
+  trace.beginBlock( "Single evaluations" );
+  unsigned int nbOk = 0;
+  nbSurfels = 0;
+  for( SurfelIterator it = ibegin; it != iend; ++it, ++nbSurfels )
+    {
+      if( ( nbSurfels < results.size() ) && ( estimator.eval( it ) == results[ nbSurfels ] )
+          && ( chunkResults[ nbSurfels ] == results[ nbSurfels ] ) )
+        ++nbOk;
+    }
+  trace.endBlock();
+  return ( ( nbSurfels == results.size() ) && ( nbSurfels == chunkResults.size() ) ) ? nbOk : 0;
+}
+
+/**
+ * Compares the range and single evaluations of the integral
+ * invariant mean and Gaussian curvature estimators on a 3D ball.
+ */
+bool testDigitalSurfaceConvolver3D( double h, double re )
+{
+  typedef Z3i::Space::RealPoint RealPoint;
+  typedef Z3i::KSpace::Surfel Surfel;
+  typedef Z3i::Domain Domain;
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef VisitorRange::ConstIterator VisitorConstIterator;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z3i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z3i::KSpace > MySpelFunctor;
+  typedef IntegralInvariantMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIMeanEstimator;
+  typedef IntegralInvariantGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIGaussianEstimator;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSurfaceConvolver in 3D" );
+
+  ImplicitShape ishape( RealPoint( 0, 0, 0 ), 5.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -10.0, -10.0, -10.0 ), RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  VisitorConstIterator ibegin = range.begin();
+  VisitorConstIterator iend = range.end();
+  std::vector< Surfel > surfels( ibegin, iend );
+
+  unsigned int nbSurfels = 0;
+  MyIIMeanEstimator meanEstimator( K, functor );
+  meanEstimator.init( h, re );
+  unsigned int nbMeanOk = compareRangeAndSingleEvaluations( meanEstimator, surfels.begin(),
+                                                            surfels.end(), nbSurfels );
+  nb++, nbok += ( nbSurfels > 0 ) && ( nbMeanOk == nbSurfels ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean curvature: " << nbMeanOk << " / " << nbSurfels
+               << " identical results" << std::endl;
+
+  MyIIGaussianEstimator gaussianEstimator( K, functor );
+  gaussianEstimator.init( h, re );
+  unsigned int nbGaussianOk = compareRangeAndSingleEvaluations( gaussianEstimator, surfels.begin(),
+                                                                surfels.end(), nbSurfels );
+  nb++, nbok += ( nbSurfels > 0 ) && ( nbGaussianOk == nbSurfels ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Gaussian curvature: " << nbGaussianOk << " / " << nbSurfels
+               << " identical results" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSurfaceConvolver" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << std::endl;
+
+#ifdef WITH_OPENMP
+  // At least two threads, so that the ranges are evaluated by chunks
+  omp_set_num_threads( std::max( 2, omp_get_max_threads() ) );
+#endif
+
+  bool res = testDigitalSurfaceConvolver3D( 0.6, 3.0 )
+    && testDigitalSurfaceConvolver3D( 0.2, 1.0 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
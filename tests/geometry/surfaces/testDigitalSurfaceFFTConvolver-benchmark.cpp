@@ -0,0 +1,199 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceFFTConvolver-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the integral invariant mean and Gaussian curvature
+ * estimators on a ball, with the incremental convolution on masks
+ * (DigitalSurfaceConvolver) and with the FFT based convolution
+ * (DigitalSurfaceFFTConvolver), for several kernel radii: timings,
+ * maximal difference between both backends and mean error with
+ * respect to the true curvatures.
+ *
+ * Usage: testDigitalSurfaceFFTConvolver-benchmark [h] [radius_1 ... radius_n]
+ * (default: 0.2 1 2 4 6, for a ball of radius 10).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/FunctorOnCells.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantGaussianCurvatureEstimator.h"
+#include "DGtal/kernel/BasicPointFunctors.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class DigitalSurfaceFFTConvolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Evaluates an estimator on a range of surfels with one backend.
+ *
+ * @return the time of the evaluation (ms).
+ */
+template< typename Estimator, typename SurfelIterator >
+double evaluate( Estimator & estimator, const bool useFFT,
+                 const SurfelIterator & ibegin, const SurfelIterator & iend,
+                 std::vector< typename Estimator::Quantity > & results )
+{
+  results.clear();
+  std::back_insert_iterator< std::vector< typename Estimator::Quantity > > resultsIt( results );
+  estimator.setFFTConvolution( useFFT );
+  Clock c;
+  c.startClock();
+  estimator.eval( ibegin, iend, resultsIt );
+  return c.stopClock();
+}
+
+/**
+ * Compares the results of both backends and with the true value.
+ */
+void compare( const std::vector< double > & direct, const std::vector< double > & fft,
+              const double expected, double & maxDifference,
+              double & directError, double & fftError )
+{
+  maxDifference = 0.0;
+  directError = 0.0;
+  fftError = 0.0;
+  for( unsigned int i = 0; i < direct.size(); ++i )
+    {
+      maxDifference = std::max( maxDifference, std::abs( direct[ i ] - fft[ i ] ) );
+      directError += std::abs( direct[ i ] - expected );
+      fftError += std::abs( fft[ i ] - expected );
+    }
+  directError /= direct.size();
+  fftError /= fft.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef Z3i::Space::RealPoint RealPoint;
+  typedef Z3i::KSpace::Surfel Surfel;
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z3i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z3i::KSpace > MySpelFunctor;
+  typedef IntegralInvariantMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIMeanEstimator;
+  typedef IntegralInvariantGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIGaussianEstimator;
+
+  trace.beginBlock ( "Benchmarking class DigitalSurfaceFFTConvolver" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const double h = ( argc > 1 ) ? atof( argv[ 1 ] ) : 0.2;
+  std::vector< double > radii;
+  for ( int i = 2; i < argc; ++i )
+    radii.push_back( atof( argv[ i ] ) );
+  if ( radii.empty() )
+    {
+      radii.push_back( 1.0 );
+      radii.push_back( 2.0 );
+      radii.push_back( 4.0 );
+      radii.push_back( 6.0 );
+    }
+
+  const double ballRadius = 10.0;
+  ImplicitShape ishape( RealPoint( 0, 0, 0 ), ballRadius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -20.0, -20.0, -20.0 ), RealPoint( 20.0, 20.0, 20.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+    {
+      trace.error() << "Problem with Khalimsky space" << std::endl;
+      return 1;
+    }
+
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 100000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Z3i::Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Surfel > surfels( range.begin(), range.end() );
+  trace.info() << surfels.size() << " surfels, h=" << h << std::endl;
+
+  std::cout << "# radius(grid steps) estimator time_direct(ms) time_fft(ms) "
+            << "max_difference mean_error_direct mean_error_fft" << std::endl;
+
+  bool res = true;
+  std::vector< double > direct, fft;
+  double maxDifference, directError, fftError;
+  for ( unsigned int r = 0; r < radii.size(); ++r )
+    {
+      const double re = radii[ r ];
+
+      MyIIMeanEstimator meanEstimator( K, functor );
+      meanEstimator.init( h, re );
+      double tDirect = evaluate( meanEstimator, false, surfels.begin(), surfels.end(), direct );
+      double tFFT = evaluate( meanEstimator, true, surfels.begin(), surfels.end(), fft );
+      compare( direct, fft, 1.0 / ballRadius, maxDifference, directError, fftError );
+      std::cout << re / h << " mean " << tDirect << " " << tFFT << " "
+                << maxDifference << " " << directError << " " << fftError << std::endl;
+      res = res && ( direct.size() == fft.size() );
+
+      MyIIGaussianEstimator gaussianEstimator( K, functor );
+      gaussianEstimator.init( h, re );
+      tDirect = evaluate( gaussianEstimator, false, surfels.begin(), surfels.end(), direct );
+      tFFT = evaluate( gaussianEstimator, true, surfels.begin(), surfels.end(), fft );
+      compare( direct, fft, 1.0 / ( ballRadius * ballRadius ), maxDifference, directError, fftError );
+      std::cout << re / h << " gaussian " << tDirect << " " << tFFT << " "
+                << maxDifference << " " << directError << " " << fftError << std::endl;
+      res = res && ( direct.size() == fft.size() );
+    }
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
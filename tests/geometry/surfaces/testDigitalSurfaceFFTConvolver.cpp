@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceFFTConvolver.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DigitalSurfaceFFTConvolver: the integral
+ * invariant estimators give the same results with the FFT based
+ * convolution as with the incremental convolution on masks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <cmath>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/FunctorOnCells.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantGaussianCurvatureEstimator.h"
+#include "DGtal/kernel/BasicPointFunctors.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfaceFFTConvolver.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Evaluates an estimator on a range of surfels with the incremental
+ * convolution and with the FFT based convolution.
+ *
+ * @return the maximal absolute difference between both results, or
+ * -1 if the numbers of results differ.
+ */
+template< typename Estimator, typename SurfelIterator >
+double compareBackends( Estimator & estimator,
+                        const SurfelIterator & ibegin,
+                        const SurfelIterator & iend )
+{
+  typedef typename Estimator::Quantity Quantity;
+
+  std::vector< Quantity > directResults;
+  std::back_insert_iterator< std::vector< Quantity > > directIt( directResults );
+  trace.beginBlock( "Incremental convolution" );
+  estimator.setFFTConvolution( false );
+  estimator.eval( ibegin, iend, directIt );
+  trace.endBlock();
+
+  std::vector< Quantity > fftResults;
+  std::back_insert_iterator< std::vector< Quantity > > fftIt( fftResults );
+  trace.beginBlock( "FFT based convolution" );
+  estimator.setFFTConvolution( true );
+  estimator.eval( ibegin, iend, fftIt );
+  trace.endBlock();
+
+  if( directResults.size() != fftResults.size() || directResults.empty() )
+    return -1.0;
+
+  double error = 0.0;
+  for( unsigned int i = 0; i < directResults.size(); ++i )
+    error = std::max( error, std::abs( directResults[ i ] - fftResults[ i ] ) );
+  return error;
+}
+
+/**
+ * Compares both backends of the integral invariant mean curvature
+ * estimator on a 2D disk.
+ */
+bool testDigitalSurfaceFFTConvolver2D( double h, double re )
+{
+  typedef Z2i::Space::RealPoint RealPoint;
+  typedef Z2i::KSpace::Surfel Surfel;
+  typedef Z2i::Domain Domain;
+  typedef ImplicitBall<Z2i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z2i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z2i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z2i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z2i::KSpace > MySpelFunctor;
+  typedef IntegralInvariantMeanCurvatureEstimator< Z2i::KSpace, MySpelFunctor > MyIIMeanEstimator;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSurfaceFFTConvolver in 2D" );
+
+  ImplicitShape ishape( RealPoint( 0, 0 ), 15.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -20.0, -20.0 ), RealPoint( 20.0, 20.0 ), h );
+
+  Z2i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Surfel bel = Surfaces<Z2i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z2i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Surfel > surfels( range.begin(), range.end() );
+
+  MyIIMeanEstimator meanEstimator( K, functor );
+  meanEstimator.init( h, re );
+  double error = compareBackends( meanEstimator, surfels.begin(), surfels.end() );
+  nb++, nbok += ( error == 0.0 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean curvature on " << surfels.size() << " surfels, max error = " << error << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares both backends of the integral invariant mean and Gaussian
+ * curvature estimators on a 3D ball.
+ */
+bool testDigitalSurfaceFFTConvolver3D( double h, double re )
+{
+  typedef Z3i::Space::RealPoint RealPoint;
+  typedef Z3i::KSpace::Surfel Surfel;
+  typedef Z3i::Domain Domain;
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z3i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z3i::KSpace > MySpelFunctor;
+  typedef IntegralInvariantMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIMeanEstimator;
+  typedef IntegralInvariantGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIGaussianEstimator;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSurfaceFFTConvolver in 3D" );
+
+  ImplicitShape ishape( RealPoint( 0, 0, 0 ), 5.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -10.0, -10.0, -10.0 ), RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Surfel > surfels( range.begin(), range.end() );
+
+  /// Volumes are exact with both backends
+  MyIIMeanEstimator meanEstimator( K, functor );
+  meanEstimator.init( h, re );
+  double meanError = compareBackends( meanEstimator, surfels.begin(), surfels.end() );
+  nb++, nbok += ( meanError == 0.0 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean curvature on " << surfels.size() << " surfels, max error = " << meanError << std::endl;
+
+  /// Covariance matrices only differ by rounding errors
+  MyIIGaussianEstimator gaussianEstimator( K, functor );
+  gaussianEstimator.init( h, re );
+  double gaussianError = compareBackends( gaussianEstimator, surfels.begin(), surfels.end() );
+  nb++, nbok += ( gaussianError >= 0.0 ) && ( gaussianError < 1e-6 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Gaussian curvature on " << surfels.size() << " surfels, max error = " << gaussianError << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSurfaceFFTConvolver" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << std::endl;
+
+  /// re/h is not an integer in 2D, so that no point lies exactly on
+  /// the kernel boundary (the masks of the incremental convolution are
+  /// digitized separately and may differ from the full kernel there).
+  bool res = testDigitalSurfaceFFTConvolver2D( 0.1, 5.05 )
+    && testDigitalSurfaceFFTConvolver3D( 0.6, 3.0 )
+    && testDigitalSurfaceFFTConvolver3D( 0.2, 1.5 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
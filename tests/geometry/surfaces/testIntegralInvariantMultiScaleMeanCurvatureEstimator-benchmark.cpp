@@ -0,0 +1,189 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegralInvariantMultiScaleMeanCurvatureEstimator-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the multi-scale integral invariant mean curvature
+ * estimator on a ball: the mean curvatures for n radii evaluated in
+ * one pass (IntegralInvariantMultiScaleMeanCurvatureEstimator), versus
+ * n independent IntegralInvariantMeanCurvatureEstimator runs, with the
+ * incremental convolution on masks and with the FFT based convolution.
+ *
+ * Usage: testIntegralInvariantMultiScaleMeanCurvatureEstimator-benchmark [h] [max_radius] [n]
+ * (default: 0.4 4 8, i.e. radii 0.5, 1, ..., 4, for a ball of radius 10).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/FunctorOnCells.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMultiScaleMeanCurvatureEstimator.h"
+#include "DGtal/kernel/BasicPointFunctors.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class IntegralInvariantMultiScaleMeanCurvatureEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Evaluates an independent mean curvature estimator for each radius.
+ *
+ * @param[out] results the results, radius by radius.
+ * @return the time of the initializations and evaluations (ms).
+ */
+template< typename KSpace, typename SpelFunctor, typename SurfelIterator >
+double evaluateSingleScale( const KSpace & K, const SpelFunctor & functor, const bool useFFT,
+                            const double h, const std::vector< double > & radii,
+                            const SurfelIterator & ibegin, const SurfelIterator & iend,
+                            std::vector< std::vector< double > > & results )
+{
+  typedef IntegralInvariantMeanCurvatureEstimator< KSpace, SpelFunctor > MyIIMeanEstimator;
+
+  results = std::vector< std::vector< double > >( radii.size() );
+  Clock c;
+  c.startClock();
+  for ( unsigned int r = 0; r < radii.size(); ++r )
+    {
+      std::back_insert_iterator< std::vector< double > > resultsIt( results[ r ] );
+      MyIIMeanEstimator estimator( K, functor );
+      estimator.init( h, radii[ r ] );
+      estimator.setFFTConvolution( useFFT );
+      estimator.eval( ibegin, iend, resultsIt );
+    }
+  return c.stopClock();
+}
+
+/**
+ * @return the maximal absolute difference between the multi-scale
+ * results and the results of the independent estimators.
+ */
+double maxDifference( const std::vector< std::vector< double > > & multiScale,
+                      const std::vector< std::vector< double > > & singleScale )
+{
+  double difference = 0.0;
+  for ( unsigned int r = 0; r < singleScale.size(); ++r )
+    for ( unsigned int i = 0; i < singleScale[ r ].size(); ++i )
+      difference = std::max( difference, std::abs( multiScale[ i ][ r ] - singleScale[ r ][ i ] ) );
+  return difference;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef Z3i::Space::RealPoint RealPoint;
+  typedef Z3i::KSpace::Surfel Surfel;
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z3i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z3i::KSpace > MySpelFunctor;
+  typedef IntegralInvariantMultiScaleMeanCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIMultiScaleEstimator;
+
+  trace.beginBlock ( "Benchmarking class IntegralInvariantMultiScaleMeanCurvatureEstimator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const double h = ( argc > 1 ) ? atof( argv[ 1 ] ) : 0.4;
+  const double maxRadius = ( argc > 2 ) ? atof( argv[ 2 ] ) : 4.0;
+  const unsigned int nbRadii = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 8;
+  std::vector< double > radii;
+  for ( unsigned int r = 1; r <= nbRadii; ++r )
+    radii.push_back( maxRadius * r / nbRadii );
+
+  const double ballRadius = 10.0;
+  ImplicitShape ishape( RealPoint( 0, 0, 0 ), ballRadius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -20.0, -20.0, -20.0 ), RealPoint( 20.0, 20.0, 20.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+    {
+      trace.error() << "Problem with Khalimsky space" << std::endl;
+      return 1;
+    }
+
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 100000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Z3i::Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Surfel > surfels( range.begin(), range.end() );
+  trace.info() << surfels.size() << " surfels, h=" << h << ", "
+               << nbRadii << " radii up to " << maxRadius / h << " grid steps" << std::endl;
+
+  std::vector< std::vector< double > > multiScale;
+  std::back_insert_iterator< std::vector< std::vector< double > > > multiScaleIt( multiScale );
+  Clock c;
+  c.startClock();
+  MyIIMultiScaleEstimator estimator( K, functor );
+  estimator.init( h, radii );
+  estimator.eval( surfels.begin(), surfels.end(), multiScaleIt );
+  const double tMultiScale = c.stopClock();
+
+  std::vector< std::vector< double > > direct, fft;
+  const double tDirect = evaluateSingleScale( K, functor, false, h, radii, surfels.begin(), surfels.end(), direct );
+  const double tFFT = evaluateSingleScale( K, functor, true, h, radii, surfels.begin(), surfels.end(), fft );
+
+  std::cout << "# nb_radii max_radius(grid steps) time_multiscale(ms) "
+            << "time_independent_direct(ms) time_independent_fft(ms) "
+            << "max_difference_direct max_difference_fft" << std::endl;
+  std::cout << nbRadii << " " << maxRadius / h << " " << tMultiScale << " "
+            << tDirect << " " << tFFT << " "
+            << maxDifference( multiScale, direct ) << " "
+            << maxDifference( multiScale, fft ) << std::endl;
+
+  bool res = ( multiScale.size() == surfels.size() );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
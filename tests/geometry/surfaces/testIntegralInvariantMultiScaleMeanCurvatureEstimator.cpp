@@ -0,0 +1,312 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegralInvariantMultiScaleMeanCurvatureEstimator.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class IntegralInvariantMultiScaleMeanCurvatureEstimator:
+ * the mean curvatures of all the radii are the ones of independent
+ * IntegralInvariantMeanCurvatureEstimator runs. Also checks the
+ * covariance matrices of nested kernels of DigitalSurfaceFFTConvolver
+ * against the Gaussian curvature estimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <cmath>
+#include "DGtal/base/Common.h"
+
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/geometry/surfaces/FunctorOnCells.h"
+#include "DGtal/graph/DepthFirstVisitor.h"
+#include "DGtal/graph/GraphVisitorRange.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMeanCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantGaussianCurvatureEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantMultiScaleMeanCurvatureEstimator.h"
+#include "DGtal/kernel/BasicPointFunctors.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IntegralInvariantMultiScaleMeanCurvatureEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Evaluates the multi-scale estimator on a range of surfels, and an
+ * independent mean curvature estimator for each radius.
+ *
+ * @return the maximal absolute difference between both results, or
+ * -1 if the numbers of results differ.
+ */
+template< typename KSpace, typename SpelFunctor, typename SurfelIterator >
+double compareWithSingleScale( const KSpace & K, const SpelFunctor & functor,
+                               const double h, const std::vector< double > & radii,
+                               const SurfelIterator & ibegin,
+                               const SurfelIterator & iend )
+{
+  typedef IntegralInvariantMultiScaleMeanCurvatureEstimator< KSpace, SpelFunctor > MyIIMultiScaleEstimator;
+  typedef IntegralInvariantMeanCurvatureEstimator< KSpace, SpelFunctor > MyIIMeanEstimator;
+  typedef typename MyIIMultiScaleEstimator::Quantity Quantity;
+  typedef typename MyIIMultiScaleEstimator::Quantities Quantities;
+
+  std::vector< Quantities > multiScaleResults;
+  std::back_insert_iterator< std::vector< Quantities > > multiScaleIt( multiScaleResults );
+  trace.beginBlock( "Multi-scale estimation" );
+  MyIIMultiScaleEstimator multiScaleEstimator( K, functor );
+  multiScaleEstimator.init( h, radii );
+  multiScaleEstimator.eval( ibegin, iend, multiScaleIt );
+  trace.info() << multiScaleEstimator << std::endl;
+  trace.endBlock();
+
+  const std::vector< double > & sortedRadii = multiScaleEstimator.radii();
+  double error = 0.0;
+  for( unsigned int r = 0; r < sortedRadii.size(); ++r )
+    {
+      std::vector< Quantity > results;
+      std::back_insert_iterator< std::vector< Quantity > > resultsIt( results );
+      trace.beginBlock( "Single scale estimation" );
+      MyIIMeanEstimator meanEstimator( K, functor );
+      meanEstimator.init( h, sortedRadii[ r ] );
+      meanEstimator.eval( ibegin, iend, resultsIt );
+      trace.endBlock();
+
+      if( results.size() != multiScaleResults.size() || results.empty() )
+        return -1.0;
+      for( unsigned int i = 0; i < results.size(); ++i )
+        {
+          if( multiScaleResults[ i ].size() != sortedRadii.size() )
+            return -1.0;
+          error = std::max( error, std::abs( multiScaleResults[ i ][ r ] - results[ i ] ) );
+        }
+    }
+  return error;
+}
+
+/**
+ * Compares the multi-scale estimator with independent estimators on a
+ * 2D disk.
+ */
+bool testIntegralInvariantMultiScaleMeanCurvatureEstimator2D( double h, const std::vector< double > & radii )
+{
+  typedef Z2i::Space::RealPoint RealPoint;
+  typedef Z2i::KSpace::Surfel Surfel;
+  typedef Z2i::Domain Domain;
+  typedef ImplicitBall<Z2i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z2i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z2i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z2i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z2i::KSpace > MySpelFunctor;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing IntegralInvariantMultiScaleMeanCurvatureEstimator in 2D" );
+
+  ImplicitShape ishape( RealPoint( 0, 0 ), 15.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -20.0, -20.0 ), RealPoint( 20.0, 20.0 ), h );
+
+  Z2i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Surfel bel = Surfaces<Z2i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z2i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Surfel > surfels( range.begin(), range.end() );
+
+  double error = compareWithSingleScale( K, functor, h, radii, surfels.begin(), surfels.end() );
+  nb++, nbok += ( error == 0.0 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean curvatures on " << surfels.size() << " surfels, max error = " << error << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the multi-scale estimator with independent estimators on a
+ * 3D ball, and the covariance matrices of nested kernels with the
+ * Gaussian curvature estimator.
+ */
+bool testIntegralInvariantMultiScaleMeanCurvatureEstimator3D( double h, const std::vector< double > & radii )
+{
+  typedef Z3i::Space::RealPoint RealPoint;
+  typedef Z3i::KSpace::Surfel Surfel;
+  typedef Z3i::Domain Domain;
+  typedef ImplicitBall<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef DepthFirstVisitor< MyDigitalSurface > Visitor;
+  typedef GraphVisitorRange< Visitor > VisitorRange;
+  typedef PointFunctorFromPointPredicateAndDomain< DigitalShape, Z3i::Domain, unsigned int > MyPointFunctor;
+  typedef FunctorOnCells< MyPointFunctor, Z3i::KSpace > MySpelFunctor;
+  typedef IntegralInvariantGaussianCurvatureEstimator< Z3i::KSpace, MySpelFunctor > MyIIGaussianEstimator;
+  typedef MyIIGaussianEstimator::KernelSupport KernelSupport;
+  typedef MyIIGaussianEstimator::DigitalShapeKernel DigitalShapeKernel;
+  typedef MyIIGaussianEstimator::FFTConvolver MyFFTConvolver;
+  typedef GaussianCurvatureFunctor3< MyFFTConvolver::CovarianceMatrix > MyGaussianFunctor;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing IntegralInvariantMultiScaleMeanCurvatureEstimator in 3D" );
+
+  ImplicitShape ishape( RealPoint( 0, 0, 0 ), 5.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( RealPoint( -10.0, -10.0, -10.0 ), RealPoint( 10.0, 10.0, 10.0 ), h );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+
+  Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+
+  Domain domain = dshape.getDomain();
+  MyPointFunctor pointFunctor( dshape, domain, 1, 0 );
+  MySpelFunctor functor( pointFunctor, K );
+
+  VisitorRange range( new Visitor( surf, *surf.begin() ));
+  std::vector< Surfel > surfels( range.begin(), range.end() );
+
+  /// Volumes are exact
+  double meanError = compareWithSingleScale( K, functor, h, radii, surfels.begin(), surfels.end() );
+  nb++, nbok += ( meanError == 0.0 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean curvatures on " << surfels.size() << " surfels, max error = " << meanError << std::endl;
+
+  /// Covariance matrices of nested kernels only differ by rounding errors
+  std::vector< double > sortedRadii( radii );
+  std::sort( sortedRadii.begin(), sortedRadii.end() );
+  std::vector< KernelSupport * > kernels( sortedRadii.size() );
+  std::vector< DigitalShapeKernel * > digKernels( sortedRadii.size() );
+  std::vector< const DigitalShapeKernel * > nestedKernels( sortedRadii.size() );
+  std::vector< MyGaussianFunctor > gaussianFunctors( sortedRadii.size() );
+  for( unsigned int r = 0; r < sortedRadii.size(); ++r )
+    {
+      kernels[ r ] = new KernelSupport( RealPoint( 0.0, 0.0, 0.0 ), sortedRadii[ r ] );
+      digKernels[ r ] = new DigitalShapeKernel();
+      digKernels[ r ]->attach( *kernels[ r ] );
+      digKernels[ r ]->init( kernels[ r ]->getLowerBound(), kernels[ r ]->getUpperBound(), h );
+      nestedKernels[ r ] = digKernels[ r ];
+      gaussianFunctors[ r ].init( h, sortedRadii[ r ] );
+    }
+
+  MyFFTConvolver convolver( functor, K );
+  convolver.init( Z3i::Point( 0, 0, 0 ), nestedKernels );
+  nb++, nbok += ( convolver.nbKernels() == sortedRadii.size() ) ? 1 : 0;
+
+  std::vector< std::vector< double > > multiScaleResults;
+  std::back_insert_iterator< std::vector< std::vector< double > > > multiScaleIt( multiScaleResults );
+  convolver.evalCovarianceMatrixAllKernels( surfels.begin(), surfels.end(), multiScaleIt, gaussianFunctors );
+
+  double gaussianError = 0.0;
+  for( unsigned int r = 0; r < sortedRadii.size(); ++r )
+    {
+      std::vector< double > results;
+      std::back_insert_iterator< std::vector< double > > resultsIt( results );
+      MyIIGaussianEstimator gaussianEstimator( K, functor );
+      gaussianEstimator.init( h, sortedRadii[ r ] );
+      gaussianEstimator.eval( surfels.begin(), surfels.end(), resultsIt );
+      if( results.size() != multiScaleResults.size() )
+        {
+          gaussianError = -1.0;
+          break;
+        }
+      for( unsigned int i = 0; i < results.size(); ++i )
+        gaussianError = std::max( gaussianError, std::abs( multiScaleResults[ i ][ r ] - results[ i ] ) );
+    }
+  nb++, nbok += ( gaussianError >= 0.0 ) && ( gaussianError < 1e-6 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Gaussian curvatures on " << surfels.size() << " surfels, max error = " << gaussianError << std::endl;
+
+  for( unsigned int r = 0; r < sortedRadii.size(); ++r )
+    {
+      delete digKernels[ r ];
+      delete kernels[ r ];
+    }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IntegralInvariantMultiScaleMeanCurvatureEstimator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << std::endl;
+
+  /// Radii are given unsorted on purpose. In 2D, re/h is not an
+  /// integer so that no point lies exactly on the kernel boundary (see
+  /// testDigitalSurfaceFFTConvolver.cpp).
+  std::vector< double > radii2D;
+  radii2D.push_back( 3.05 );
+  radii2D.push_back( 2.05 );
+  radii2D.push_back( 5.05 );
+  radii2D.push_back( 4.05 );
+
+  std::vector< double > radii3D;
+  radii3D.push_back( 1.5 );
+  radii3D.push_back( 0.6 );
+  radii3D.push_back( 1.0 );
+
+  bool res = testIntegralInvariantMultiScaleMeanCurvatureEstimator2D( 0.1, radii2D )
+    && testIntegralInvariantMultiScaleMeanCurvatureEstimator3D( 0.2, radii3D );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << std::endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -609,6 +609,87 @@ bool testCompareExactInexact(unsigned int size, unsigned int nb)
   return true;
 }
 
+/**
+ * Checks that incremental updates after site insertions/removals
+ * give the same maps as a computation from scratch.
+ */
+template <typename Space, int norm>
+bool testUpdate(unsigned int size, unsigned int nb)
+{
+  trace.beginBlock("Checking incremental updates");
+  typedef ExactPredicateLpSeparableMetric<Space, norm> Metric;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef NotPointPredicate<Set> NegPredicate;
+  typedef DistanceTransformation<Space, NegPredicate, Metric> DT;
+
+  unsigned int nbok = 0;
+  unsigned int nbtests = 0;
+
+  Domain domain(Point::diagonal(0), Point::diagonal(size));
+  Set set(domain);
+  for(unsigned int i = 0; i<nb; ++i)
+    {
+      Point p;
+      for(unsigned int dim=0;  dim<Space::dimension;++dim)
+        p[dim]  = rand() % (size+1);
+      set.insert(p);
+    }
+
+  Metric metric;
+  NegPredicate negPred(set);
+  DT dt(&domain, &negPred, &metric, true);
+  //partial maps computed at the first update
+  DT lazy(&domain, &negPred, &metric);
+
+  for(unsigned int round = 0; round < 5; ++round)
+    {
+      //Flips a few points, the last round removes all the sites
+      std::vector<Point> modified;
+      if (round == 4)
+        {
+          modified.insert(modified.end(), set.begin(), set.end());
+          set.clear();
+        }
+      else
+        for(unsigned int i = 0; i < nb/2 + 1; ++i)
+          {
+            Point p;
+            for(unsigned int dim=0;  dim<Space::dimension;++dim)
+              p[dim]  = rand() % (size+1);
+            if (set(p))
+              set.erase(p);
+            else
+              set.insert(p);
+            modified.push_back(p);
+          }
+      dt.update(modified.begin(), modified.end());
+      lazy.update(modified.begin(), modified.end());
+
+      DT fresh(&domain, &negPred, &metric);
+      bool ok = true;
+      for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it)
+        if ((dt.getVoronoiVector(*it) != fresh.getVoronoiVector(*it))
+            || (dt(*it) != fresh(*it))
+            || (lazy.getVoronoiVector(*it) != fresh.getVoronoiVector(*it)))
+          {
+            trace.error() << "Round " << round << ", error at " << *it << ": "
+                          << dt.getVoronoiVector(*it) << " instead of "
+                          << fresh.getVoronoiVector(*it) << std::endl;
+            ok = false;
+            break;
+          }
+      nbok += ok ? 1 : 0;
+      nbtests++;
+      trace.info() << "(" << nbok << "/" << nbtests << ") "
+                   << modified.size() << " modified points" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nbtests;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -630,6 +711,9 @@ int main ( int argc, char** argv ){
     && testCompareExactInexact<Z3i::Space, 2>(50, 50)
     && testCompareExactInexact<Z2i::Space, 4>(50, 50)
     && testCompareExactInexact<Z3i::Space, 4>(50, 50)
+    && testUpdate<Z2i::Space, 2>(40, 30)
+    && testUpdate<Z3i::Space, 2>(25, 40)
+    && testUpdate<Z3i::Space, 1>(25, 40)
     ;
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,142 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * FMM signed distance to a sphere in a n^3 volume with the different
+ * containers of candidate points.
+ *
+ * Usage: testFMM-benchmark [size] [withSTLSet] (default: 96 1).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class FMM.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+typedef DigitalSetBySTLSet<Z3i::Domain> Set;
+typedef DigitalSetByBitVector<Z3i::Domain> BitSet;
+typedef DomainPredicate<Z3i::Domain> Predicate;
+
+/**
+ * Runs FMM with the accepted point set TSet and the candidate
+ * container TQueue from the points lying at less than one half from
+ * a sphere centered in the domain.
+ * @return the time of the propagation (in ms).
+ */
+template <typename TSet, typename TQueue>
+double runFMM( const Z3i::Domain &aDomain, const std::string &aName, Image &aMap )
+{
+  typedef L2FirstOrderLocalDistance<Image, TSet> Distance;
+  typedef FMM<Image, TSet, Predicate, Distance, TQueue> MyFMM;
+
+  const Z3i::Point c = ( aDomain.lowerBound() + aDomain.upperBound() ) / 2;
+  const double r = ( aDomain.upperBound()[0] - aDomain.lowerBound()[0] ) / 4.0;
+  TSet set( aDomain );
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    {
+      const double d = ( *it - c ).norm() - r;
+      if ( std::abs( d ) < 0.5 )
+        {
+          aMap.setValue( *it, d );
+          set.insert( *it );
+        }
+    }
+
+  Predicate dp( aDomain );
+  Distance distance( aMap, set );
+  trace.beginBlock( aName );
+  MyFMM fmm( aMap, set, dp, aDomain.size() + 1,
+             std::numeric_limits<double>::max(), distance );
+  fmm.compute();
+  const double t = trace.endBlock();
+  trace.info() << fmm << std::endl;
+  trace.info() << "  " << aDomain.size() / ( t * 1000.0 ) << " Mvoxels/s" << std::endl;
+  return t;
+}
+
+/**
+ * Compares the default FMM (STL set of accepted points, STL set of
+ * candidates) with the bit vector of accepted points and the other
+ * candidate containers. The default one is skipped if @a withSTLSet
+ * is 'false' (its memory grows as a tree node per voxel).
+ */
+bool runABenchmark( const unsigned int size, const bool withSTLSet )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  trace.info() << "Domain " << size << "^3" << std::endl;
+
+  Image map1( domain ), map2( domain );
+  double t1 = 0.0;
+  if ( withSTLSet )
+    t1 = runFMM<Set, FMMCandidateSet<Z3i::Point, double> >( domain, "FMM, STL sets (default)", map1 );
+  else
+    runFMM<BitSet, FMMCandidateHeap<Z3i::Point, double> >( domain, "FMM, bit vector, binary heap", map1 );
+  const double t2 = runFMM<BitSet, FMMCandidateBucketQueue<Z3i::Point, double> >
+    ( domain, "FMM, bit vector, bucketed heap", map2 );
+  if ( withSTLSet )
+    trace.info() << "Speed-up over the default FMM: " << t1 / t2 << std::endl;
+
+  bool ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        ( it != itEnd ) && ok; ++it )
+    ok = ( map1( *it ) == map2( *it ) );
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class FMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int size = ( argc > 1 ) ? atoi( argv[1] ) : 96;
+  const bool withSTLSet = ( argc > 2 ) ? ( atoi( argv[2] ) != 0 ) : true;
+  bool res = runABenchmark( size, withSTLSet );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
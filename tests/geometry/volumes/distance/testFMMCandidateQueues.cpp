@@ -0,0 +1,273 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMMCandidateQueues.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the containers of candidate points of FMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/FMMCandidateQueues.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the containers of candidate points of FMM.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Pushes random pairs into @a aQueue, as FMM does (new values are
+ * not lower than the last popped one, up to a small amount), pops
+ * them all and compares the sequence with the one of FMMCandidateSet.
+ */
+template <typename TQueue>
+bool checkPopOrder( TQueue &aQueue )
+{
+  typedef typename TQueue::PointValue PointValue;
+  FMMCandidateSet<Z2i::Point, double> reference;
+
+  srand( 0 );
+  std::vector<PointValue> popped, expected;
+  double front = 0.0;
+  int id = 0;
+  for ( unsigned int step = 0; step < 2000; ++step )
+    {
+      const unsigned int nb = rand() % 4;
+      for ( unsigned int i = 0; i < nb; ++i, ++id )
+        {
+          //some values are equal, some are slightly lower than the front
+          const double v = front - 0.05 + ( rand() % 64 ) / 16.0;
+          const PointValue pair( Z2i::Point( id % 37, id / 37 ),
+                                 ( rand() % 2 ) ? v : -v );
+          aQueue.push( pair );
+          reference.push( pair );
+        }
+      if ( !reference.empty() && ( rand() % 3 ) )
+        {
+          expected.push_back( reference.top() );
+          popped.push_back( aQueue.top() );
+          front = std::abs( reference.top().second );
+          reference.pop();
+          aQueue.pop();
+        }
+      if ( aQueue.size() != reference.size() )
+        return false;
+    }
+  while ( !reference.empty() )
+    {
+      expected.push_back( reference.top() );
+      popped.push_back( aQueue.top() );
+      reference.pop();
+      aQueue.pop();
+    }
+  trace.info() << aQueue << " " << popped.size() << " pops" << std::endl;
+  return aQueue.empty() && ( popped == expected );
+}
+
+bool testCandidateQueues()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing pop order of the candidate containers..." );
+
+  FMMCandidateHeap<Z2i::Point, double> heap;
+  nbok += checkPopOrder( heap ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") binary heap" << std::endl;
+
+  FMMCandidateBucketQueue<Z2i::Point, double> buckets;
+  nbok += checkPopOrder( buckets ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bucketed heap" << std::endl;
+
+  FMMCandidateBucketQueue<Z2i::Point, double> wideBuckets( 2.5 );
+  nbok += checkPopOrder( wideBuckets ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bucketed heap, wide buckets" << std::endl;
+
+  FMMCandidateBucketQueue<Z2i::Point, double> narrowWindow( 0.0625, 3 );
+  nbok += checkPopOrder( narrowWindow ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bucketed heap, overflow bucket" << std::endl;
+
+  //far keys go to the overflow bucket
+  FMMCandidateBucketQueue<Z2i::Point, double> farKeys;
+  farKeys.push( std::make_pair( Z2i::Point( 0, 0 ), 1.0 ) );
+  farKeys.push( std::make_pair( Z2i::Point( 1, 0 ), 1e9 ) );
+  farKeys.push( std::make_pair( Z2i::Point( 2, 0 ), -50.0 ) );
+  bool farOk = ( farKeys.top().second == 1.0 );
+  farKeys.pop();
+  farOk = farOk && ( farKeys.top().second == -50.0 );
+  farKeys.pop();
+  farOk = farOk && ( farKeys.top().second == 1e9 );
+  farKeys.pop();
+  nbok += ( farOk && farKeys.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") far keys" << std::endl;
+
+  //container reused after clear
+  buckets.clear();
+  buckets.push( std::make_pair( Z2i::Point( 1, 1 ), 10.0 ) );
+  buckets.push( std::make_pair( Z2i::Point( 0, 1 ), -3.0 ) );
+  nbok += ( buckets.size() == 2 && buckets.top().second == -3.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") clear" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Runs FMM with the candidate container TQueue and the accepted
+ * point set TSet from a signed initialization (the signed distances
+ * to a single interface: two parallel lines of values -0.5 and 0.5)
+ * and compares the result with the default container and a
+ * DigitalSetBySTLSet.
+ */
+template <typename TQueue, typename TSet, typename Domain>
+bool checkFMM( const Domain &aDomain, const double aValueThreshold )
+{
+  typedef typename Domain::Point Point;
+  typedef ImageContainerBySTLVector<Domain, double> Image;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef DomainPredicate<Domain> Predicate;
+  typedef L2SecondOrderLocalDistance<Image, Set> Distance;
+  typedef L2SecondOrderLocalDistance<Image, TSet> OtherDistance;
+  typedef FMM<Image, Set, Predicate, Distance> DefaultFMM;
+  typedef FMM<Image, TSet, Predicate, OtherDistance, TQueue> OtherFMM;
+
+  Image map1( aDomain ), map2( aDomain );
+  Set set1( aDomain );
+  TSet set2( aDomain );
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    {
+      const Point &p = *it;
+      double v = 0.0;
+      bool isSeed = false;
+      if ( p[0] == 0 ) { v = -0.5; isSeed = true; }
+      else if ( p[0] == 1 ) { v = 0.5; isSeed = true; }
+      if ( isSeed )
+        {
+          map1.setValue( p, v );
+          map2.setValue( p, v );
+          set1.insert( p );
+          set2.insert( p );
+        }
+    }
+
+  Predicate dp( aDomain );
+  const unsigned long area = aDomain.size() + 1;
+  Distance distance1( map1, set1 );
+  DefaultFMM fmm1( map1, set1, dp, area, aValueThreshold, distance1 );
+  fmm1.compute();
+  OtherDistance distance2( map2, set2 );
+  OtherFMM fmm2( map2, set2, dp, area, aValueThreshold, distance2 );
+  fmm2.compute();
+  trace.info() << fmm2 << std::endl;
+
+  bool ok = ( set1.size() == set2.size() ) && fmm2.isValid();
+  for ( typename Set::ConstIterator it = set1.begin(), itEnd = set1.end();
+        ( it != itEnd ) && ok; ++it )
+    ok = ( set2.find( *it ) != set2.end() ) && ( map1( *it ) == map2( *it ) );
+  return ok;
+}
+
+bool testFMMWithCandidateQueues()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing FMM with the candidate containers..." );
+
+  typedef FMMCandidateHeap<Z2i::Point, double> Heap2;
+  typedef FMMCandidateBucketQueue<Z2i::Point, double> Buckets2;
+  typedef FMMCandidateHeap<Z3i::Point, double> Heap3;
+  typedef FMMCandidateBucketQueue<Z3i::Point, double> Buckets3;
+  typedef DigitalSetBySTLSet<Z2i::Domain> Set2;
+  typedef DigitalSetByBitVector<Z2i::Domain> BitSet2;
+  typedef DigitalSetBySTLSet<Z3i::Domain> Set3;
+  typedef DigitalSetByBitVector<Z3i::Domain> BitSet3;
+
+  Z2i::Domain d2( Z2i::Point( -20, -15 ), Z2i::Point( 25, 30 ) );
+  nbok += checkFMM<Heap2, Set2>( d2, 100.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 2D binary heap" << std::endl;
+  nbok += checkFMM<Buckets2, Set2>( d2, 100.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 2D bucketed heap" << std::endl;
+  nbok += checkFMM<Buckets2, Set2>( d2, 7.5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 2D bucketed heap, value threshold" << std::endl;
+
+  Z3i::Domain d3( Z3i::Point( -8, -6, -5 ), Z3i::Point( 9, 7, 10 ) );
+  nbok += checkFMM<Heap3, Set3>( d3, 100.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 3D binary heap" << std::endl;
+  nbok += checkFMM<Buckets3, Set3>( d3, 100.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 3D bucketed heap" << std::endl;
+
+  nbok += checkFMM<Buckets2, BitSet2>( d2, 7.5 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 2D bucketed heap, bit vector set" << std::endl;
+  nbok += checkFMM<Buckets3, BitSet3>( d3, 100.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 3D bucketed heap, bit vector set" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing the containers of candidate points of FMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCandidateQueues()
+    && testFMMWithCandidateQueues(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
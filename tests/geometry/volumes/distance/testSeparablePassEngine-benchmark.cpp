@@ -0,0 +1,170 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSeparablePassEngine-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Per-axis throughput of the separable passes: line by line
+ * point-wise passes versus SeparablePassEngine bundles.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/SeparablePassEngine.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class SeparablePassEngine.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::int64_t> Image;
+
+/**
+ * 1D squared distance transform (two sweeps) on a line of 0/infinite
+ * values.
+ */
+struct LineSweep
+{
+  bool operator()( const Z3i::Point &start, const Z3i::Point &end,
+                   const Dimension dim, DGtal::int64_t *line ) const
+  {
+    const Z3i::Integer n = end[dim] - start[dim] + 1;
+    for ( Z3i::Integer i = 1; i < n; ++i )
+      line[i] = std::min( line[i], line[i-1] + 1 );
+    for ( Z3i::Integer i = n - 2; i >= 0; --i )
+      line[i] = std::min( line[i], line[i+1] + 1 );
+    return true;
+  }
+};
+
+/**
+ * Same pass computed line by line through the image accessors.
+ */
+void naivePass( Image &image, const Dimension dim )
+{
+  const Z3i::Domain &domain = image.domain();
+  std::vector<Z3i::Domain::Size> subdomain;
+  for ( int k = 2; k >= 0; --k )
+    if ( (Dimension)k != dim )
+      subdomain.push_back( k );
+  std::vector<DGtal::int64_t> line( domain.upperBound()[dim] - domain.lowerBound()[dim] + 1 );
+  LineSweep sweep;
+  for ( Z3i::Domain::ConstSubRange::ConstIterator
+          it = domain.subRange( subdomain ).begin(),
+          itend = domain.subRange( subdomain ).end();
+        it != itend; ++it )
+    {
+      Z3i::Point p = *it, end = *it;
+      end[dim] = domain.upperBound()[dim];
+      for ( size_t i = 0; i < line.size(); ++i, ++p[dim] )
+        line[i] = image( p );
+      sweep( *it, end, dim, &line[0] );
+      p = *it;
+      for ( size_t i = 0; i < line.size(); ++i, ++p[dim] )
+        image.setValue( p, line[i] );
+    }
+}
+
+void initImage( Image &image )
+{
+  const DGtal::int64_t infinity = 1 << 30;
+  srand( 0 );
+  for ( Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it )
+    *it = ( rand() % 1000 == 0 ) ? 0 : infinity;
+}
+
+bool runABenchmark( const unsigned int size )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  const double nbVoxels = (double)size * size * size;
+  Image image( domain );
+
+  trace.beginBlock( "Domain " + boost::lexical_cast<std::string>( size ) + "^3" );
+  for ( Dimension dim = 0; dim < 3; ++dim )
+    {
+      initImage( image );
+      trace.beginBlock( "Line by line pass, axis "
+                        + boost::lexical_cast<std::string>( dim ) );
+      naivePass( image, dim );
+      double t = trace.endBlock();
+      trace.info() << "  " << nbVoxels / ( t * 1000.0 ) << " Mvoxels/s" << std::endl;
+
+      const Z3i::Domain::Size sizes[] = { 1, 4, 16, 64 };
+      for ( unsigned int s = 0; s < 4; ++s )
+        {
+          initImage( image );
+          SeparablePassEngine<Image> engine( domain.lowerBound(),
+                                             domain.upperBound(), sizes[s] );
+          trace.beginBlock( "Engine pass, axis "
+                            + boost::lexical_cast<std::string>( dim )
+                            + ", bundle size "
+                            + boost::lexical_cast<std::string>( sizes[s] ) );
+          engine.run( image, dim, LineSweep() );
+          t = trace.endBlock();
+          trace.info() << "  " << nbVoxels / ( t * 1000.0 ) << " Mvoxels/s" << std::endl;
+        }
+    }
+
+  Z3i::DigitalSet set( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( rand() % 1000 != 0 )
+      set.insertNew( *it );
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  L2Metric l2;
+  trace.beginBlock( "Full L2 distance transformation" );
+  DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain, set, l2 );
+  double t = trace.endBlock();
+  trace.info() << "  " << nbVoxels / ( t * 1000.0 ) << " Mvoxels/s" << std::endl;
+
+  trace.endBlock();
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class SeparablePassEngine" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = runABenchmark( 64 ) && runABenchmark( 256 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,202 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSeparablePassEngine.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class SeparablePassEngine.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/SeparablePassEngine.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SeparablePassEngine.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+
+/**
+ * Line processor computing prefix sums along the line. Lines whose
+ * starting point has an odd first coordinate are left untouched.
+ */
+struct PrefixSum
+{
+  bool operator()( const Z3i::Point &start, const Z3i::Point &end,
+                   const Dimension dim, int *line ) const
+  {
+    if ( start[0] % 2 != 0 )
+      return false;
+    for ( Z3i::Integer i = 1; i <= end[dim] - start[dim]; ++i )
+      line[i] += line[i-1];
+    return true;
+  }
+};
+
+/**
+ * Runs a pass with a given bundle size and compares it to a naive
+ * point-wise line by line computation.
+ */
+bool testPass( const Z3i::Domain &domain, const Dimension dim,
+               const Z3i::Domain::Size bundleSize )
+{
+  Image image( domain );
+  Image expected( domain );
+  int k = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it, ++k )
+    {
+      image.setValue( *it, k % 7 );
+      expected.setValue( *it, k % 7 );
+    }
+
+  //Naive computation
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      Z3i::Point first = *it;
+      first[dim] = domain.lowerBound()[dim];
+      if ( ( (*it)[dim] != first[dim] ) && ( first[0] % 2 == 0 ) )
+        {
+          Z3i::Point prev = *it;
+          prev[dim]--;
+          expected.setValue( *it, expected( *it ) + expected( prev ) );
+        }
+    }
+
+  SeparablePassEngine<Image> engine( domain.lowerBound(),
+                                     domain.upperBound(), bundleSize );
+  trace.info() << engine << " dim=" << dim << std::endl;
+  engine.run( image, dim, PrefixSum() );
+
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( image( *it ) != expected( *it ) )
+      {
+        trace.error() << "Error at " << *it << ": " << image( *it )
+                      << " instead of " << expected( *it ) << std::endl;
+        return false;
+      }
+  return true;
+}
+
+bool testSeparablePassEngine()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing passes with various bundle sizes..." );
+  //Extents are not multiple of the bundle sizes
+  Z3i::Domain domain( Z3i::Point( -3, 2, 0 ), Z3i::Point( 14, 10, 6 ) );
+  const Z3i::Domain::Size sizes[] = { 1, 3, 16, 64 };
+  for ( Dimension dim = 0; dim < 3; ++dim )
+    for ( unsigned int s = 0; s < 4; ++s )
+      {
+        nbok += testPass( domain, dim, sizes[s] ) ? 1 : 0;
+        nb++;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  SeparablePassEngine<Image> engine( domain.lowerBound(), domain.upperBound() );
+  nbok += ( engine.nbLines( 0 ) == 9*7 ) ? 1 : 0;
+  nb++;
+  nbok += ( engine.nbLines( 2 ) == 18*9 ) ? 1 : 0;
+  nb++;
+  nbok += engine.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") nbLines" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Checks the Voronoi map computed through the engine against a brute
+ * force closest site search.
+ */
+bool testVoronoiMapThroughEngine()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing VoronoiMap passes..." );
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 17, 23 ) );
+  Z3i::DigitalSet sites( domain );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 30; ++i )
+    sites.insert( Z3i::Point( rand() % 21, rand() % 18, rand() % 24 ) );
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef NotPointPredicate<Z3i::DigitalSet> NegPredicate;
+  L2Metric l2;
+  NegPredicate negSet( sites );
+  VoronoiMap<Z3i::Space, NegPredicate, L2Metric> voro( domain, negSet, l2 );
+
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const Z3i::Point site = voro( *it );
+      const double d = l2( *it, site );
+      bool ok = sites( site );
+      for ( Z3i::DigitalSet::ConstIterator its = sites.begin(),
+              itsend = sites.end(); its != itsend; ++its )
+        if ( l2( *it, *its ) < d )
+          ok = false;
+      nbok += ok ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SeparablePassEngine" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSeparablePassEngine()
+    && testVoronoiMapThroughEngine(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
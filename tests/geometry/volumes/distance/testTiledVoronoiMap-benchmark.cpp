@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTiledVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Out-of-core Voronoi map of a n^3 volume stored in a raw file
+ * through a TiledImage: timings, cache misses and peak resident
+ * memory.
+ *
+ * Usage: testTiledVoronoiMap-benchmark [size [nbTiles [rawFile]]]
+ * (default: 128 8 testTiledVoronoiMap-benchmark.raw). The map of a
+ * size^3 volume needs size^3*sizeof(Point) bytes on disk; the memory
+ * budget is about (nbTiles+1) tiles of (size/nbTiles)^3 points.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromRawFile.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/geometry/volumes/distance/TiledVoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class TiledVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Point predicate returning false on a pseudo-random sparse set of
+ * sites (about one point out of 4096), without storing them.
+ */
+struct SparseSites
+{
+  typedef Z3i::Point Point;
+
+  bool operator()( const Point &p ) const
+  {
+    DGtal::uint64_t h = ( (DGtal::uint64_t) p[0] * 73856093ULL )
+      ^ ( (DGtal::uint64_t) p[1] * 19349663ULL )
+      ^ ( (DGtal::uint64_t) p[2] * 83492791ULL );
+    h ^= h >> 17;
+    h *= 0xed5ad4bbULL;
+    h ^= h >> 11;
+    return ( h & 4095 ) != 0;
+  }
+};
+
+/**
+ * @return the peak resident set size in MB (0 if unavailable).
+ */
+double peakRSS()
+{
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+  if ( getrusage( RUSAGE_SELF, &usage ) == 0 )
+#if defined(__APPLE__)
+    return usage.ru_maxrss / ( 1024.0 * 1024.0 );
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+  return 0.0;
+}
+
+bool runABenchmark( const unsigned int size, const unsigned int nbTiles,
+                    const std::string &filename )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Point> Image;
+  typedef ImageFactoryFromRawFile<Image> Factory;
+  typedef ImageCacheReadPolicyFIFO<Image, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWB<Image, Factory> WritePolicy;
+  typedef TiledImage<Image, Factory, ReadPolicy, WritePolicy> Tiled;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  const double nbVoxels = (double)size * size * size;
+  const double tileSize = (double)( size / nbTiles ) * ( size / nbTiles ) * ( size / nbTiles );
+
+  trace.info() << "Domain " << size << "^3, " << nbTiles << "^3 tiles, raw file "
+               << nbVoxels * sizeof( Z3i::Point ) / ( 1024.0 * 1024.0 ) << " MB, "
+               << "cache budget " << ( nbTiles + 1 ) * tileSize * sizeof( Z3i::Point ) / ( 1024.0 * 1024.0 )
+               << " MB" << std::endl;
+
+  Factory factory( domain, filename, true, true );
+  ReadPolicy readPolicy( factory, nbTiles + 1 );
+  WritePolicy writePolicy( factory );
+  Tiled tiled( factory, readPolicy, writePolicy, nbTiles );
+
+  L2Metric l2;
+  SparseSites predicate;
+  trace.beginBlock( "Tiled Voronoi map" );
+  TiledVoronoiMap<Z3i::Space, SparseSites, L2Metric, Tiled> voro( tiled, predicate, l2 );
+  double t = trace.endBlock();
+
+  trace.info() << voro << std::endl;
+  trace.info() << "  " << nbVoxels / ( t * 1000.0 ) << " Mvoxels/s, "
+               << tiled.getCacheMissRead() << " read misses, "
+               << tiled.getCacheMissWrite() << " write misses, peak RSS "
+               << peakRSS() << " MB" << std::endl;
+  return voro.isValid();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class TiledVoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int size = ( argc > 1 ) ? atoi( argv[1] ) : 128;
+  const unsigned int nbTiles = ( argc > 2 ) ? atoi( argv[2] ) : 8;
+  const std::string filename = ( argc > 3 ) ? argv[3] : "testTiledVoronoiMap-benchmark.raw";
+
+  bool res = runABenchmark( size, nbTiles, filename );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,193 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTiledVoronoiMap.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class TiledVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageFactoryFromRawFile.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/TiledVoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class TiledVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the Voronoi map of random sites with a TiledVoronoiMap
+ * stored in a tiled image built on the factory type TFactory, and
+ * compares it with the in-memory VoronoiMap.
+ */
+template <typename TFactory, typename TMetric>
+bool checkTiledVoronoiMap( TFactory &factory,
+                           const typename TFactory::Domain &domain,
+                           const TMetric &metric,
+                           const unsigned int nbTiles,
+                           const unsigned int cacheSize,
+                           const unsigned int nbSites )
+{
+  typedef typename TFactory::Domain Domain;
+  typedef typename Domain::Space Space;
+  typedef typename Domain::Point Point;
+  typedef typename TFactory::OutputImage OutputImage;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef NotPointPredicate<Set> NegPredicate;
+
+  typedef ImageCacheReadPolicyFIFO<OutputImage, TFactory> ReadPolicy;
+  typedef ImageCacheWritePolicyWB<OutputImage, TFactory> WritePolicy;
+  typedef TiledImage<OutputImage, TFactory, ReadPolicy, WritePolicy> Tiled;
+
+  Set sites( domain );
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    {
+      Point p;
+      for ( Dimension k = 0; k < Space::dimension; ++k )
+        p[k] = domain.lowerBound()[k]
+          + rand() % ( domain.upperBound()[k] - domain.lowerBound()[k] + 1 );
+      sites.insert( p );
+    }
+  NegPredicate negSet( sites );
+
+  ReadPolicy readPolicy( factory, cacheSize );
+  WritePolicy writePolicy( factory );
+  Tiled tiled( factory, readPolicy, writePolicy, nbTiles );
+
+  TiledVoronoiMap<Space, NegPredicate, TMetric, Tiled> tiledVoro( tiled, negSet, metric );
+  trace.info() << tiledVoro << " cache misses=" << tiled.getCacheMissRead()
+               << std::endl;
+
+  VoronoiMap<Space, NegPredicate, TMetric> voro( domain, negSet, metric );
+
+  bool ok = tiledVoro.isValid();
+  for ( typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    if ( ( tiledVoro( *it ) != voro( *it ) )
+         || ( tiledVoro.distance( *it ) != metric( *it, voro( *it ) ) ) )
+      {
+        trace.error() << "Error at " << *it << ": " << tiledVoro( *it )
+                      << " instead of " << voro( *it ) << std::endl;
+        ok = false;
+        break;
+      }
+  return ok;
+}
+
+bool testTiledVoronoiMap2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 2D tiled Voronoi map (in-memory factory)..." );
+  srand( 0 );
+  //Extents are not multiple of the number of tiles
+  Z2i::Domain domain( Z2i::Point( -5, 3 ), Z2i::Point( 40, 36 ) );
+  typedef ImageContainerBySTLVector<Z2i::Domain, Z2i::Point> Image;
+  typedef ImageFactoryFromImage<Image> Factory;
+
+  ExactPredicateLpSeparableMetric<Z2i::Space, 2> l2;
+  ExactPredicateLpSeparableMetric<Z2i::Space, 1> l1;
+
+  Image image1( domain );
+  Factory factory1( image1 );
+  nbok += checkTiledVoronoiMap( factory1, domain, l2, 4, 5, 20 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L2" << std::endl;
+
+  Image image2( domain );
+  Factory factory2( image2 );
+  nbok += checkTiledVoronoiMap( factory2, domain, l1, 3, 4, 20 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L1" << std::endl;
+
+  //Cache smaller than a slab
+  Image image3( domain );
+  Factory factory3( image3 );
+  nbok += checkTiledVoronoiMap( factory3, domain, l2, 4, 2, 20 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L2, small cache" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+bool testTiledVoronoiMap3D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 3D tiled Voronoi map (raw file factory)..." );
+  srand( 0 );
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 17, 23 ) );
+  typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Point> Image;
+  typedef ImageFactoryFromRawFile<Image> Factory;
+
+  ExactPredicateLpSeparableMetric<Z3i::Space, 2> l2;
+  Factory factory( domain, "testTiledVoronoiMap.raw", true, true );
+  trace.info() << factory << std::endl;
+  nbok += checkTiledVoronoiMap( factory, domain, l2, 3, 4, 30 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L2" << std::endl;
+
+  //Single site
+  Factory factory2( domain, "testTiledVoronoiMap2.raw", true, true );
+  nbok += checkTiledVoronoiMap( factory2, domain, l2, 2, 3, 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") L2, single site" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class TiledVoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testTiledVoronoiMap2D()
+    && testTiledVoronoiMap3D(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
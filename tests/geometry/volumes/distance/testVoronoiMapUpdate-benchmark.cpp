@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMapUpdate-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Incremental update of a distance transformation after local edits
+ * versus computation from scratch.
+ *
+ * Usage: testVoronoiMapUpdate-benchmark [size] (default: 128).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking VoronoiMap::update.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef SimpleThresholdForegroundPredicate<Image> Predicate;
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+typedef DistanceTransformation<Z3i::Space, Predicate, L2Metric> DT;
+
+/**
+ * Flips @a nb points of the image (sites become foreground points and
+ * conversely), either in a ball of radius @a radius centered in the
+ * domain or anywhere if @a radius is zero.
+ */
+void flip( Image &image, const unsigned int nb, const unsigned int radius,
+           std::vector<Z3i::Point> &modified )
+{
+  const Z3i::Domain &domain = image.domain();
+  const Z3i::Point center = ( domain.lowerBound() + domain.upperBound() ) / 2;
+  modified.clear();
+  while ( modified.size() < nb )
+    {
+      Z3i::Point p;
+      if ( radius == 0 )
+        for ( Dimension k = 0; k < 3; ++k )
+          p[k] = rand() % ( domain.upperBound()[k] + 1 );
+      else
+        {
+          for ( Dimension k = 0; k < 3; ++k )
+            p[k] = center[k] - (int)radius + rand() % ( 2 * radius + 1 );
+          if ( ( p - center ).dot( p - center ) > (int)( radius * radius ) )
+            continue;
+        }
+      image.setValue( p, image( p ) == 0 ? 1 : 0 );
+      modified.push_back( p );
+    }
+}
+
+bool runABenchmark( const unsigned int size )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it )
+    *it = ( rand() % 1000 == 0 ) ? 0 : 1;
+
+  L2Metric l2;
+  Predicate predicate( image, 0 );
+  trace.beginBlock( "Construction (partial maps kept)" );
+  DT dt( &domain, &predicate, &l2, true );
+  trace.endBlock();
+
+  std::vector<Z3i::Point> modified;
+
+  bool ok = true;
+  const unsigned int nbs[] = { 100, 1000, 5000 };
+  const unsigned int radii[] = { 0, 8, 16 };
+  for ( unsigned int r = 0; r < 3; ++r )
+    for ( unsigned int n = 0; n < 3; ++n )
+      {
+        flip( image, nbs[n], radii[r], modified );
+        const std::string edit = boost::lexical_cast<std::string>( nbs[n] )
+          + ( radii[r] == 0 ? std::string( " scattered" )
+              : " in a ball of radius " + boost::lexical_cast<std::string>( radii[r] ) );
+
+        trace.beginBlock( "Update, " + edit );
+        dt.update( modified.begin(), modified.end() );
+        const double tUpdate = trace.endBlock();
+
+        trace.beginBlock( "Rebuild, " + edit );
+        DT fresh( &domain, &predicate, &l2 );
+        const double tRebuild = trace.endBlock();
+        trace.info() << "  speed-up " << tRebuild / tUpdate << std::endl;
+
+        for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+              it != itend && ok; ++it )
+          ok = ( dt.getVoronoiVector( *it ) == fresh.getVoronoiVector( *it ) );
+      }
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking VoronoiMap updates" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int size = ( argc > 1 ) ? atoi( argv[1] ) : 128;
+  bool res = runABenchmark( size );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
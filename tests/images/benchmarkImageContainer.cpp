@@ -36,6 +36,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
 
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
@@ -49,7 +50,10 @@ using namespace DGtal;
 
 typedef DGtal::ImageContainerBySTLVector< Z2i::Domain, DGtal::int32_t> ImageVector2;
 typedef DGtal::ImageContainerBySTLMap< Z2i::Domain, DGtal::int32_t> ImageMap2;
-typedef DGtal::experimental::ImageContainerByHashTree< Z2i::Domain, DGtal::int32_t> ImageHash2;
+typedef DGtal::ImageContainerByHashTree< Z2i::Domain, DGtal::int32_t> ImageHash2;
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t> ImageVector3;
+typedef DGtal::ImageContainerByBricks< Z3i::Domain, DGtal::int32_t> ImageBricks3;
+typedef DGtal::ImageContainerBySparseBlocks< Z2i::Domain, DGtal::int32_t> ImageSparse2;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -66,6 +70,7 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageHash2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_Constructor, ImageSparse2)->Range(1<<3 , 1 << 12);
 
 template<typename Point>
 std::set<Point> ConstructRandomSet(int size, int maxWidth) {
@@ -108,7 +113,8 @@ static void BM_SetValue(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_SetValue, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageMap2)->Range(1<<3 , 1 << 16);
-BENCHMARK_TEMPLATE(BM_SetValue, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_SetValue, ImageHash2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_SetValue, ImageSparse2)->Range(1<<3 , 1 << 12);
 
 template<typename Q>
 static void BM_RangeScan(benchmark::State& state)
@@ -133,6 +139,8 @@ static void BM_RangeScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_RangeScan, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_RangeScan, ImageSparse2)->Range(1<<3 , 1 << 10);
 
 template<typename Q>
 static void BM_DomainScan(benchmark::State& state)
@@ -157,6 +165,61 @@ static void BM_DomainScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_DomainScan, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_DomainScan, ImageSparse2)->Range(1<<3 , 1 << 10);
+
+static void BM_BulkBuildHash(benchmark::State& state)
+{
+  std::set<Z2i::Point> data = ConstructRandomSet<Z2i::Point>(state.range_x(),state.range_x());
+
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      Z2i::Domain dom(Z2i::Point().diagonal(0),
+                      Z2i::Point().diagonal(state.range_x()));
+      state.ResumeTiming();
+      ImageHash2 image( dom, data.begin(), data.end(), 42 );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*data.size());
+}
+BENCHMARK(BM_BulkBuildHash)->Range(1<<3 , 1 << 16);
+
+template<typename Q>
+static void BM_Stencil26(benchmark::State& state)
+{
+  typename Q::Domain dom(typename Q::Point().diagonal(0),
+                         typename Q::Point().diagonal(state.range_x()-1));
+  Q image( dom );
+  DGtal::int32_t v = 0;
+  for(typename Q::Domain::ConstIterator it = dom.begin(), itend=dom.end();
+      it != itend; ++it)
+    image.setValue( *it , v++ % 255 );
+
+  //Sum over the 26-neighborhood of the interior points, scanned
+  //along the slowest axis
+  const typename Q::Domain interior(typename Q::Point().diagonal(1),
+                                    typename Q::Point().diagonal(state.range_x()-2));
+  int64_t cpt=0;
+  while (state.KeepRunning())
+    {
+      int64_t sum = 0;
+      for(typename Q::Point::Coordinate x = 1; x <= interior.upperBound()[0]; ++x)
+        for(typename Q::Point::Coordinate y = 1; y <= interior.upperBound()[1]; ++y)
+          for(typename Q::Point::Coordinate z = 1; z <= interior.upperBound()[2]; ++z)
+            {
+              const typename Q::Point p(x, y, z);
+              for(int dz = -1; dz <= 1; ++dz)
+                for(int dy = -1; dy <= 1; ++dy)
+                  for(int dx = -1; dx <= 1; ++dx)
+                    sum += image( p + typename Q::Point(dx, dy, dz) );
+              cpt++;
+            }
+      benchmark::DoNotOptimize( sum ); //to prevent compiler optimization
+    }
+  state.SetItemsProcessed(cpt);
+}
+BENCHMARK_TEMPLATE(BM_Stencil26, ImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Stencil26, ImageBricks3)->Range(1<<5 , 1 << 8);
 
 
 
@@ -0,0 +1,261 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkImageHelper.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the kernels of ImageHelper on ImageContainerBySTLVector
+ * and of image expressions (in voxels per second) against the same
+ * operations point by point.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <functional>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageExpression.h"
+#include "DGtal/images/imagesSetsUtils/IntervalForegroundPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+/////// Micro Bench
+
+typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t> Image;
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char> Mask;
+
+Image randomImage(int size)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(size-1));
+  Image image(dom);
+  for(Image::Iterator it = image.begin(), itend = image.end(); it != itend; ++it)
+    *it = rand() % 256;
+  return image;
+}
+
+static void BM_MaskPointByPoint(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  Mask mask(image.domain());
+  IntervalForegroundPredicate<Image> pred(image, 64, 192);
+  while (state.KeepRunning())
+    {
+      for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+          it != itend; ++it)
+        mask.setValue( *it, pred( *it ) ? 1 : 0 );
+      benchmark::DoNotOptimize( mask[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_MaskPointByPoint)->Range(1<<5 , 1 << 8);
+
+static void BM_MaskKernel(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  Mask mask(image.domain());
+  while (state.KeepRunning())
+    {
+      maskFromImage( image, mask, 64, 192 );
+      benchmark::DoNotOptimize( mask[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_MaskKernel)->Range(1<<5 , 1 << 8);
+
+static void BM_SetPointByPoint(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  while (state.KeepRunning())
+    {
+      Z3i::DigitalSet set(image.domain());
+      DigitalSetInserter<Z3i::DigitalSet> inserter(set);
+      setFromPointsRangeAndFunctor( image.domain().begin(), image.domain().end(), inserter, image, 32 );
+      benchmark::DoNotOptimize( set.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_SetPointByPoint)->Range(1<<5 , 1 << 8);
+
+static void BM_SetKernel(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  while (state.KeepRunning())
+    {
+      Z3i::DigitalSet set(image.domain());
+      DigitalSetInserter<Z3i::DigitalSet> inserter(set);
+      setFromImage( image, inserter, 32 );
+      benchmark::DoNotOptimize( set.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_SetKernel)->Range(1<<5 , 1 << 8);
+
+static void BM_SumPointByPoint(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  const Image image2 = randomImage(state.range_x());
+  Image sum(image.domain());
+  while (state.KeepRunning())
+    {
+      for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+          it != itend; ++it)
+        sum.setValue( *it, image( *it ) + image2( *it ) );
+      benchmark::DoNotOptimize( sum[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_SumPointByPoint)->Range(1<<5 , 1 << 8);
+
+static void BM_SumKernel(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  const Image image2 = randomImage(state.range_x());
+  Image sum(image.domain());
+  while (state.KeepRunning())
+    {
+      transformImage( image, image2, sum, std::plus<DGtal::int32_t>() );
+      benchmark::DoNotOptimize( sum[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_SumKernel)->Range(1<<5 , 1 << 8);
+
+static void BM_MinMaxPointByPoint(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  while (state.KeepRunning())
+    {
+      DGtal::int32_t mn = image( image.domain().lowerBound() ), mx = mn;
+      for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+          it != itend; ++it)
+        {
+          mn = std::min( mn, image( *it ) );
+          mx = std::max( mx, image( *it ) );
+        }
+      benchmark::DoNotOptimize( mn + mx );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_MinMaxPointByPoint)->Range(1<<5 , 1 << 8);
+
+static void BM_MinMaxKernel(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  while (state.KeepRunning())
+    {
+      DGtal::int32_t mn, mx;
+      imageMinMax( image, mn, mx );
+      benchmark::DoNotOptimize( mn + mx );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_MinMaxKernel)->Range(1<<5 , 1 << 8);
+
+static void BM_HistogramKernel(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  std::vector<unsigned int> histogram(256);
+  while (state.KeepRunning())
+    {
+      imageHistogram( image, 0, 255, histogram );
+      benchmark::DoNotOptimize( histogram[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_HistogramKernel)->Range(1<<5 , 1 << 8);
+
+static void BM_RescaleKernel(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  Mask output(image.domain());
+  while (state.KeepRunning())
+    {
+      rescaleImage( image, output, 0.5, 10.0 );
+      benchmark::DoNotOptimize( output[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_RescaleKernel)->Range(1<<5 , 1 << 8);
+
+typedef std::binder1st< std::multiplies<DGtal::int32_t> > Scale;
+typedef std::binder1st< std::plus<DGtal::int32_t> > Shift;
+typedef ConstImageAdapter<Image, Z3i::Domain, DefaultFunctor, DGtal::int32_t, Scale> ScaledImage;
+typedef ConstImageAdapter<ScaledImage, Z3i::Domain, DefaultFunctor, DGtal::int32_t, Shift> ShiftedImage;
+
+static void BM_AdapterChainPointByPoint(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  const Image image2 = randomImage(state.range_x());
+  Image output(image.domain());
+  DefaultFunctor df;
+  Scale scale( std::multiplies<DGtal::int32_t>(), 3 );
+  Shift shift( std::plus<DGtal::int32_t>(), -7 );
+  ScaledImage scaled( image, image.domain(), df, scale );
+  ShiftedImage shifted( scaled, image.domain(), df, shift );
+  while (state.KeepRunning())
+    {
+      for(Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end();
+          it != itend; ++it)
+        output.setValue( *it, shifted( *it ) + image2( *it ) );
+      benchmark::DoNotOptimize( output[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_AdapterChainPointByPoint)->Range(1<<5 , 1 << 8);
+
+static void BM_AdapterChainExpression(benchmark::State& state)
+{
+  const Image image = randomImage(state.range_x());
+  const Image image2 = randomImage(state.range_x());
+  Image output(image.domain());
+  DefaultFunctor df;
+  Scale scale( std::multiplies<DGtal::int32_t>(), 3 );
+  Shift shift( std::plus<DGtal::int32_t>(), -7 );
+  ScaledImage scaled( image, image.domain(), df, scale );
+  ShiftedImage shifted( scaled, image.domain(), df, shift );
+  while (state.KeepRunning())
+    {
+      materialize( imageExpression( shifted ) + imageExpression( image2 ), output );
+      benchmark::DoNotOptimize( output[0] );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.size());
+}
+BENCHMARK(BM_AdapterChainExpression)->Range(1<<5 , 1 << 8);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  const char*argv[] )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
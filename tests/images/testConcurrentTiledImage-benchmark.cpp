@@ -0,0 +1,161 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentTiledImage-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Sweep of a 3D image (reading a 6-neighborhood mean and writing it
+ * back) through a TiledImage (one thread) and a ConcurrentTiledImage
+ * (one thread, then slabs processed in parallel with OpenMP).
+ *
+ * Usage: testConcurrentTiledImage-benchmark [size] [N] [cache size]
+ * (default: 128^3 image, 8 tiles per dimension, 64 pages).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/images/ConcurrentTiledImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+typedef ImageFactoryFromImage<Image> Factory;
+typedef Factory::OutputImage OutputImage;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class ConcurrentTiledImage.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Mean of the 6-neighbors of the points of the slab z = aZ, written
+ * in anOutput.
+ */
+template <typename TInput, typename TOutput>
+void processSlab( const TInput & anInput, TOutput & anOutput, const int aZ )
+{
+  const Z3i::Point low = anInput.domain().lowerBound();
+  const Z3i::Point up = anInput.domain().upperBound();
+  for ( int y = low[ 1 ]; y <= up[ 1 ]; ++y )
+    for ( int x = low[ 0 ]; x <= up[ 0 ]; ++x )
+      {
+        const Z3i::Point p( x, y, aZ );
+        int sum = 0, nb = 0;
+        for ( Dimension k = 0; k < 3; ++k )
+          for ( int d = -1; d <= 1; d += 2 )
+            {
+              Z3i::Point q = p;
+              q[ k ] += d;
+              if ( ( q[ k ] >= low[ k ] ) && ( q[ k ] <= up[ k ] ) )
+                {
+                  sum += anInput( q );
+                  nb++;
+                }
+            }
+        anOutput.setValue( p, sum / nb );
+      }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class ConcurrentTiledImage" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[1] ) : 128;
+  const int N = ( argc > 2 ) ? atoi( argv[2] ) : 8;
+  const unsigned int cacheSize = ( argc > 3 ) ? atoi( argv[3] ) : 64;
+
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image input( domain );
+  int v = 0;
+  for ( Image::Iterator it = input.begin(), itEnd = input.end(); it != itEnd; ++it )
+    *it = v++ % 255;
+  trace.info() << input << ", " << N << " tiles per dimension, "
+               << cacheSize << " pages" << std::endl;
+  Factory inputFactory( input );
+
+  Clock c;
+  Image reference( domain );
+  {
+    typedef ImageCacheReadPolicyLRU<OutputImage, Factory> ReadPolicy;
+    typedef ImageCacheWritePolicyWB<OutputImage, Factory> WritePolicy;
+    ReadPolicy readPolicy( inputFactory, cacheSize );
+    WritePolicy writePolicy( inputFactory );
+    TiledImage<Image, Factory, ReadPolicy, WritePolicy> tiled( inputFactory, readPolicy, writePolicy, N );
+    c.startClock();
+    for ( int z = 0; z < size; ++z )
+      processSlab( tiled, reference, z );
+    trace.info() << "TiledImage (LRU): " << c.stopClock() << " ms, "
+                 << tiled.getCacheMissRead() << " read misses" << std::endl;
+  }
+
+  bool res = true;
+  for ( unsigned int nbThreads = 1; nbThreads <= 2; ++nbThreads )
+    {
+      Image output( domain );
+      Factory outputFactory( output );
+      {
+        ConcurrentTiledImage<Factory> tiledInput( inputFactory, N, cacheSize );
+        ConcurrentTiledImage<Factory> tiledOutput( outputFactory, N, cacheSize );
+        c.startClock();
+        if ( nbThreads == 1 )
+          for ( int z = 0; z < size; ++z )
+            processSlab( tiledInput, tiledOutput, z );
+        else
+          {
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+            for ( int z = 0; z < size; ++z )
+              processSlab( tiledInput, tiledOutput, z );
+          }
+        tiledOutput.flush();
+        trace.info() << "ConcurrentTiledImage (" << ( nbThreads == 1 ? "one thread" : "parallel" )
+                     << "): " << c.stopClock() << " ms, "
+                     << tiledInput.getCacheMissRead() << " read misses" << std::endl;
+      }
+      Image::ConstIterator itRef = reference.begin();
+      for ( Image::ConstIterator it = output.begin(), itEnd = output.end();
+            res && ( it != itEnd ); ++it, ++itRef )
+        res = ( *it == *itRef );
+    }
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
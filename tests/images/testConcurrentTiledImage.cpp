@@ -0,0 +1,212 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentTiledImage.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * @brief A test file for ConcurrentTiledImage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ConcurrentTiledImage.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentTiledImage.
+///////////////////////////////////////////////////////////////////////////////
+bool testConcurrentTiledImage()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ConcurrentTiledImage");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    VImage image(Z3i::Domain(Z3i::Point(1,1,1), Z3i::Point(30,30,30)));
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    // 4 tiles of 7 values and a last tile of 2 values for each dimension
+    typedef ConcurrentTiledImage<MyImageFactoryFromImage> MyTiledImage;
+    MyTiledImage tiledImage(imageFactoryFromImage, 4, 12, 4);
+    trace.info() << tiledImage << endl;
+
+    nbok += ( tiledImage.isValid()
+              && (tiledImage.findSubDomain(Z3i::Point(8,1,30)).lowerBound() == Z3i::Point(8,1,29))
+              && (tiledImage.findSubDomain(Z3i::Point(8,1,30)).upperBound() == Z3i::Point(14,7,30)) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "tile domains" << endl;
+
+    // Concurrent reads
+    const std::vector<Z3i::Point> points(image.domain().begin(), image.domain().end());
+    const long nbPoints = (long)points.size();
+    long nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 97) reduction(+:nbErrors)
+#endif
+    for (long k = 0; k < nbPoints; ++k)
+      if (tiledImage(points[k]) != image(points[k]))
+        nbErrors++;
+    trace.info() << tiledImage << endl;
+    nbok += ( (nbErrors == 0) && (tiledImage.getCacheHitRead() + tiledImage.getCacheMissRead() == (unsigned int)nbPoints) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "concurrent reads" << endl;
+
+    // Concurrent writes (write-back): the original image is updated
+    // when the tiles are replaced or flushed
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 97)
+#endif
+    for (long k = 0; k < nbPoints; ++k)
+      tiledImage.setValue(points[k], -(int)k);
+    tiledImage.flush();
+    nbErrors = 0;
+    for (long k = 0; k < nbPoints; ++k)
+      if (image(points[k]) != -(int)k)
+        nbErrors++;
+    trace.info() << tiledImage << endl;
+    nbok += ( (nbErrors == 0) && (tiledImage.getNbFlushed() > 0)
+              && (tiledImage.getCacheHitWrite() + tiledImage.getCacheMissWrite() == (unsigned int)nbPoints) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "concurrent writes" << endl;
+
+    // Concurrent reads and writes of the neighbor values
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 97)
+#endif
+    for (long k = 0; k < nbPoints; ++k)
+      {
+        Z3i::Point p = points[k];
+        if (p[0] > 1)
+          {
+            p[0]--;
+            tiledImage(p); // replaces tiles being written by other threads
+          }
+        tiledImage.setValue(points[k], (int)k);
+      }
+    nbErrors = 0;
+    for (long k = 0; k < nbPoints; ++k)
+      if (tiledImage(points[k]) != (int)k)
+        nbErrors++;
+    nbok += (nbErrors == 0) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "concurrent reads and writes" << endl;
+
+    // Tiles loaded ahead of time
+    MyTiledImage prefetchedImage(imageFactoryFromImage, 4, 64, 4);
+    const unsigned int nbPrefetched = prefetchedImage.prefetch(Z3i::Domain(Z3i::Point(1,1,1), Z3i::Point(14,14,14)));
+    for (Z3i::Domain::ConstIterator it = Z3i::Domain(Z3i::Point(1,1,1), Z3i::Point(14,14,14)).begin(),
+           itEnd = Z3i::Domain(Z3i::Point(1,1,1), Z3i::Point(14,14,14)).end(); it != itEnd; ++it)
+      prefetchedImage(*it);
+    nbok += ( (nbPrefetched == 8) && (prefetchedImage.getCacheMissRead() == 0) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "prefetch" << endl;
+
+    // Write-back on the I/O side: a replaced modified tile is queued,
+    // taken back when requested again, and written by prefetch()
+    MyTiledImage queuedImage(imageFactoryFromImage, 4, 1, 1);
+    queuedImage.setValue(Z3i::Point(1,1,1), 1000);
+    queuedImage(Z3i::Point(8,1,1)); // replaces the modified tile
+    const bool isQueued = (queuedImage.getNbFlushed() == 0) && (image(Z3i::Point(1,1,1)) != 1000);
+    const bool isTakenBack = (queuedImage(Z3i::Point(1,1,1)) == 1000)
+      && (queuedImage.getCacheMissRead() == 1) && (queuedImage.getNbFlushed() == 0);
+    queuedImage.prefetch(Z3i::Domain(Z3i::Point(8,1,1), Z3i::Point(8,1,1)));
+    nbok += ( isQueued && isTakenBack && (queuedImage.getNbFlushed() == 1)
+              && (image(Z3i::Point(1,1,1)) == 1000) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "write-back queue" << endl;
+
+    // Workers and a thread writing back the replaced tiles
+    const long nbSlices = 30;
+    nbErrors = 0;
+#ifdef WITH_OPENMP
+#pragma omp parallel sections
+#endif
+    {
+#ifdef WITH_OPENMP
+#pragma omp section
+#endif
+      {
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (long z = 1; z <= nbSlices; ++z)
+          for (Z3i::Domain::ConstIterator it = Z3i::Domain(Z3i::Point(1,1,z), Z3i::Point(30,30,z)).begin(),
+                 itEnd = Z3i::Domain(Z3i::Point(1,1,z), Z3i::Point(30,30,z)).end(); it != itEnd; ++it)
+            tiledImage.setValue(*it, 2 * (*it)[0] + (*it)[1]);
+      }
+#ifdef WITH_OPENMP
+#pragma omp section
+#endif
+      {
+        for (long z = 1; z <= nbSlices; z += 7)
+          tiledImage.prefetch(Z3i::Domain(Z3i::Point(1,1,z), Z3i::Point(7,7,z)));
+      }
+    }
+    tiledImage.flush();
+    for (long k = 0; k < nbPoints; ++k)
+      if (image(points[k]) != 2 * points[k][0] + points[k][1])
+        nbErrors++;
+    nbok += (nbErrors == 0) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "write-back thread" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+    trace.beginBlock ( "Testing class ConcurrentTiledImage" );
+    trace.info() << "Args:";
+    for ( int i = 0; i < argc; ++i )
+        trace.info() << " " << argv[ i ];
+    trace.info() << endl;
+
+    bool res = testConcurrentTiledImage(); // && ... other tests
+
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
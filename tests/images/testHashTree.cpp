@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <new>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/io/boards/Board2D.h"
@@ -70,7 +71,7 @@ bool testHashTree()
   typedef Space4Type::Integer Integer;
 
   //Default image selector = STLVector
-  typedef experimental::ImageContainerByHashTree<TDomain, int > Image;
+  typedef ImageContainerByHashTree<TDomain, int > Image;
 
   const Integer t[ ] = { 1, 2, 3 ,4};
   const Integer t2[ ] = { 5, 5, 3 ,4};
@@ -104,7 +105,7 @@ bool testHashTree2D()
 {
   trace.beginBlock("Testing 2D");
   Z2i::Domain domain(Z2i::Point(0,0), Z2i::Point(255,255));
-  typedef experimental::ImageContainerByHashTree<Z2i::Domain, int > Image;
+  typedef ImageContainerByHashTree<Z2i::Domain, int > Image;
 
   Image myImage(domain);
   trace.info()<< myImage<<std::endl;
@@ -131,7 +132,7 @@ bool testGetSetVal()
 
 
   //Default image selector = STLVector
-  typedef experimental::ImageContainerByHashTree<TDomain, int > Image;
+  typedef ImageContainerByHashTree<TDomain, int > Image;
   typedef ImageContainerBySTLVector<TDomain, int> ImageVector;
 
   Point a( 1,1 );
@@ -256,7 +257,7 @@ bool testBadKeySizes()
 
 
   //Default image selector = STLVector
-  typedef experimental::ImageContainerByHashTree<TDomain, char> Image;
+  typedef ImageContainerByHashTree<TDomain, char> Image;
   Point d(128,128);
 
   trace.beginBlock ( "Test maximal depth >  number of bits of the HashKey type" );
@@ -271,7 +272,7 @@ bool testBadKeySizes()
   trace.endBlock();
   
   //Default image selector = STLVector
-  typedef experimental::ImageContainerByHashTree<TDomain, unsigned int, DGtal::uint32_t> Image2;
+  typedef ImageContainerByHashTree<TDomain, unsigned int, DGtal::uint32_t> Image2;
   trace.beginBlock ( "Changing the HashKey type" );
   Image2 myImage3( 3, 80, 0 );
   trace.info() << myImage3;
@@ -281,6 +282,97 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Sums the sizes of the leaves and checks their values.
+ */
+template <typename Image>
+struct LeafChecker
+{
+  LeafChecker( const Image & anImage ): image( &anImage ), nbPoints( 0 ), ok( true ) {}
+  void operator()( const typename Image::Domain & aDomain, const typename Image::Value & aValue )
+  {
+    nbPoints += aDomain.size();
+    for ( typename Image::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+          it != itEnd; ++it )
+      ok = ok && ( (*image)( *it ) == aValue );
+  }
+  const Image * image;
+  typename Image::Size nbPoints;
+  bool ok;
+};
+
+bool testBulkOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Bulk build, lookup cache and leaves" );
+  typedef ImageContainerByHashTree<Z2i::Domain, int > Image;
+  const Z2i::Domain domain( Z2i::Point( -10, 3 ), Z2i::Point( 90, 60 ) );
+  std::vector<Z2i::Point> disk;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( ( *it - Z2i::Point( 40, 30 ) ).norm() < 20 )
+      disk.push_back( *it );
+
+  Image bulk( domain, disk.begin(), disk.end(), 5, 3, 1 );
+  Image image( domain, 3, 1 );
+  for ( std::vector<Z2i::Point>::const_iterator it = disk.begin(); it != disk.end(); ++it )
+    image.setValue( *it, 5 );
+  trace.info() << bulk;
+
+  bool ok = ( bulk.getNbNodes() == image.getNbNodes() );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( bulk( *it ) == image( *it ) )
+      && ( bulk( *it ) == ( ( ( *it - Z2i::Point( 40, 30 ) ).norm() < 20 ) ? 5 : 1 ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bulk build == point by point build" << std::endl;
+
+  // Cached lookups, the leaf found for a point being modified after the lookup
+  Image::LookupCache cache;
+  ok = true;
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( bulk.get( *it, cache ) == bulk( *it ) );
+  const Z2i::Point p( 40, 30 );
+  ok = ok && ( bulk.get( p, cache ) == 5 );
+  bulk.setValue( p + Z2i::Point( 1, 0 ), 7 );
+  ok = ok && ( bulk.get( p, cache ) == 5 ) && ( bulk.get( p + Z2i::Point( 1, 0 ), cache ) == 7 );
+  bulk.setValue( p, 8 );
+  ok = ok && ( bulk.get( p, cache ) == 8 ) && ( bulk.get( p + Z2i::Point( 0, 1 ), cache ) == 5 );
+  Image copy( bulk );
+  bulk.setValue( p, 9 );
+  ok = ok && ( copy.get( p, cache ) == 8 ) && ( bulk.get( p, cache ) == 9 );
+  // another image built at the address of a destroyed one
+  Image* recycled = new Image( domain, 3, 1 );
+  recycled->setValue( p, 7 );
+  ok = ok && ( recycled->get( p, cache ) == 7 );
+  recycled->~Image();
+  new ( recycled ) Image( domain, 3, 1 );
+  recycled->setValue( Z2i::Point( 0, 10 ), 7 );
+  ok = ok && ( recycled->get( p, cache ) == 1 );
+  delete recycled;
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "lookup cache after modifications" << std::endl;
+
+  LeafChecker<Image> checker = bulk.forEachLeaf( LeafChecker<Image>( bulk ) );
+  nbok += ( checker.ok && ( checker.nbPoints == domain.size() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "leaves cover the domain" << std::endl;
+
+  Image empty( domain, disk.begin(), disk.begin(), 5, 3, 1 );
+  nbok += ( ( empty.getNbNodes() == 1 ) && ( empty( p ) == 1 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bulk build from an empty range" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -292,7 +384,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes() && testBulkOperations();  // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
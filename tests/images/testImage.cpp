@@ -166,7 +166,7 @@ int main( int argc, char** argv )
     typedef short Value;
     typedef ImageContainerBySTLVector<Domain,Value> VImage;
     typedef ImageContainerBySTLMap<Domain,Value> MImage;
-    // TODO typedef experimental::ImageContainerByHashTree<Domain,Value> HImage;
+    // TODO typedef ImageContainerByHashTree<Domain,Value> HImage;
     // TODO typedef Image<VImage > LImage;
 
     /// tests
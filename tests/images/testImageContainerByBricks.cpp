@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBricks.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * @brief A test file for ImageContainerByBricks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBricks.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBricks.
+///////////////////////////////////////////////////////////////////////////////
+bool testImageContainerByBricks()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ImageContainerByBricks");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    typedef ImageContainerByBricks<Z3i::Domain, int> BImage;
+    BOOST_CONCEPT_ASSERT(( CImage< BImage > ));
+
+    // 3x2x3 bricks of 8^3 points, the last ones being padded
+    const Z3i::Domain domain(Z3i::Point(-3,2,1), Z3i::Point(20,12,17));
+    VImage image(domain);
+    BImage bricks(domain);
+    int i = 1;
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it, ++i)
+      {
+        image.setValue(*it, i);
+        bricks.setValue(*it, i);
+      }
+    trace.info() << bricks << endl;
+
+    bool ok = bricks.isValid() && (bricks.nbBricks() == 18) && (bricks.size() == 18 * 512);
+    std::vector<bool> used(bricks.size(), false);
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      {
+        ok = ok && (bricks(*it) == image(*it)) && (bricks.linearized(*it) < bricks.size())
+          && !used[bricks.linearized(*it)];
+        used[bricks.linearized(*it)] = true;
+      }
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "values and positions" << endl;
+
+    // Too few bricks for Morton blocks: row-major bricks
+    const Z3i::Point low = domain.lowerBound();
+    ok = (bricks.mortonBlockWidth() == 1)
+      && (bricks.linearized(low) == 0)
+      && (bricks.linearized(low + Z3i::Point(1,0,0)) == 1)
+      && (bricks.linearized(low + Z3i::Point(0,1,0)) == 8)
+      && (bricks.linearized(low + Z3i::Point(0,0,1)) == 64)
+      && (bricks.linearized(low + Z3i::Point(8,0,0)) == 512)
+      && (bricks.linearized(low + Z3i::Point(0,8,0)) == 3 * 512)
+      && (bricks.linearized(low + Z3i::Point(0,0,8)) == 6 * 512);
+
+    // 8x4x4 bricks, the last ones being padded: two Morton blocks of 4x4x4 bricks
+    const Z3i::Domain mortonDomain(Z3i::Point(1,1,1), Z3i::Point(60,32,32));
+    BImage morton(mortonDomain);
+    const Z3i::Point mlow = mortonDomain.lowerBound();
+    ok = ok && morton.isValid() && (morton.mortonBlockWidth() == 4) && (morton.nbBricks() == 128)
+      && (morton.linearized(mlow + Z3i::Point(8,0,0)) == 512)
+      && (morton.linearized(mlow + Z3i::Point(0,8,0)) == 2 * 512)
+      && (morton.linearized(mlow + Z3i::Point(8,8,0)) == 3 * 512)
+      && (morton.linearized(mlow + Z3i::Point(0,0,8)) == 4 * 512)
+      && (morton.linearized(mlow + Z3i::Point(16,0,0)) == 8 * 512)
+      && (morton.linearized(mlow + Z3i::Point(32,0,0)) == 64 * 512)
+      && (morton.linearized(mlow + Z3i::Point(59,31,31)) == 127 * 512 + 3 + 7 * 8 + 7 * 64);
+    std::vector<bool> mortonUsed(morton.size(), false);
+    for (Z3i::Domain::ConstIterator it = mortonDomain.begin(), itEnd = mortonDomain.end(); it != itEnd; ++it)
+      {
+        ok = ok && (morton.linearized(*it) < morton.size()) && !mortonUsed[morton.linearized(*it)];
+        mortonUsed[morton.linearized(*it)] = true;
+      }
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "Morton order of the bricks" << endl;
+
+    // Span iterators along each dimension, forward and backward
+    ok = true;
+    for (Dimension k = 0; k < 3; ++k)
+      {
+        Z3i::Point p(1,5,9);
+        p[k] = domain.lowerBound()[k];
+        std::vector<int> forward, backward;
+        BImage::SpanIterator itBegin = bricks.spanBegin(p, k), itEnd = bricks.spanEnd(p, k);
+        for (BImage::SpanIterator it = itBegin; it != itEnd; ++it)
+          forward.push_back(*it);
+        for (BImage::SpanIterator it = itEnd; it != itBegin; )
+          {
+            --it;
+            backward.push_back(*it);
+          }
+        std::reverse(backward.begin(), backward.end());
+        std::vector<int> expected;
+        for (VImage::SpanIterator it = image.spanBegin(p, k), itEndV = image.spanEnd(p, k); it != itEndV; ++it)
+          expected.push_back(*it);
+        ok = ok && (forward == expected) && (backward == expected);
+      }
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "span iterators" << endl;
+
+    BImage::SpanIterator it = bricks.spanBegin(Z3i::Point(-3,5,9), 0);
+    bricks.setValue(it, -1);
+    // Ranges follow the domain order
+    VImage copy(domain);
+    BImage::ConstRange r = bricks.constRange();
+    std::copy(r.begin(), r.end(), copy.range().outputIterator());
+    BImage other(domain);
+    VImage::ConstRange rv = image.constRange();
+    std::copy(rv.begin(), rv.end(), other.range().outputIterator());
+    nbok += ( (copy(Z3i::Point(-3,5,9)) == -1) && (copy(Z3i::Point(20,12,17)) == image(Z3i::Point(20,12,17)))
+              && (other(Z3i::Point(7,7,7)) == image(Z3i::Point(7,7,7))) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "ranges" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+    trace.beginBlock ( "Testing class ImageContainerByBricks" );
+    trace.info() << "Args:";
+    for ( int i = 0; i < argc; ++i )
+        trace.info() << " " << argv[ i ];
+    trace.info() << endl;
+
+    bool res = testImageContainerByBricks(); // && ... other tests
+
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
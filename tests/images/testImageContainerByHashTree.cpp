@@ -37,8 +37,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
-#define dim experimental::ImageContainerByHashTree<Domain , T, DGtal::uint64_t >::dim
-#define defHashKey typename experimental::ImageContainerByHashTree<Domain , int,  DGtal::uint64_t >::HashKey
+#define dim ImageContainerByHashTree<Domain , T, DGtal::uint64_t >::dim
+#define defHashKey typename ImageContainerByHashTree<Domain , int,  DGtal::uint64_t >::HashKey
 
 using namespace DGtal;
 
@@ -49,7 +49,7 @@ int iRand ( int iMin, int iMax )
 }
 
 template<typename Domain, typename T >
-bool test_setVal (experimental::ImageContainerByHashTree<Domain , T, DGtal::uint64_t >& container, bool checkAfterEachSet )
+bool test_setVal (ImageContainerByHashTree<Domain , T, DGtal::uint64_t >& container, bool checkAfterEachSet )
 {
   srand ( (unsigned int)time ( NULL ) );
 
@@ -117,7 +117,7 @@ bool test_setVal (experimental::ImageContainerByHashTree<Domain , T, DGtal::uint
 
 
 template<typename Domain, typename T >
-bool test_get ( experimental::ImageContainerByHashTree<Domain, T, DGtal::uint64_t >& container, bool  )
+bool test_get ( ImageContainerByHashTree<Domain, T, DGtal::uint64_t >& container, bool  )
 {
   srand ( (unsigned int)time ( NULL ) );
   unsigned count = 0;
@@ -138,7 +138,7 @@ bool test_get ( experimental::ImageContainerByHashTree<Domain, T, DGtal::uint64_
       container.setValue ( key, val );
 
 
-      typename experimental::ImageContainerByHashTree<Domain , T, DGtal::uint64_t >::HashKey key2 = key;
+      typename ImageContainerByHashTree<Domain , T, DGtal::uint64_t >::HashKey key2 = key;
       while ( container.isKeyValid ( key2 ) )
         {
           key2 = key2 << dim;
@@ -169,7 +169,7 @@ int main ( int argc, char** argv )
 
   typedef SpaceND<5> Space;
   typedef HyperRectDomain<Space> Dom;
-  typedef DGtal::experimental::ImageContainerByHashTree<Dom, int, DGtal::uint64_t> Tree;
+  typedef DGtal::ImageContainerByHashTree<Dom, int, DGtal::uint64_t> Tree;
   Tree tree ( 12,5,1 );
   // Do not pass concept.
   //BOOST_CONCEPT_ASSERT((CDrawableWithBoard2D<Tree>));
@@ -195,7 +195,7 @@ int main ( int argc, char** argv )
   p3[3] = 1;
   p3[4] = 1;
   trace.info() << "azertyuiop" << std::endl;
-  DGtal::experimental::ImageContainerByHashTree<Dom, int, DGtal::uint64_t> tree2 ( 12,p1, p2,1 );
+  DGtal::ImageContainerByHashTree<Dom, int, DGtal::uint64_t> tree2 ( 12,p1, p2,1 );
   trace.info() << "azertyuiop" << std::endl;
   trace.info() << "coord get " << tree2.get ( p1 ) << std::endl;
   trace.info() << "_-_-_-_-_-_-_-_-_-_-_-_-" << std::endl;
@@ -206,7 +206,7 @@ int main ( int argc, char** argv )
   trace.info() << "coord get " << tree2.get ( p1+=p3 ) << std::endl;
 
   // check that the iterator stuff compiles as it should
-  typedef DGtal::experimental::ImageContainerByHashTree<Dom, int, DGtal::uint64_t>::Iterator HashTreeIterator;
+  typedef DGtal::ImageContainerByHashTree<Dom, int, DGtal::uint64_t>::Iterator HashTreeIterator;
   HashTreeIterator it = tree.begin();
   for ( it = tree.begin(); it != tree.end(); ++it )
     tree ( *it );
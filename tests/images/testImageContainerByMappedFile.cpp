@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMappedFile.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * @brief A test file for ImageContainerByMappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/io/readers/RawReader.h"
+#include "DGtal/io/readers/VolReader.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedFile.
+///////////////////////////////////////////////////////////////////////////////
+bool testMappedFile()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ImageContainerByMappedFile on a raw file");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    typedef ImageContainerByMappedFile<Z2i::Domain, int> MImage;
+    BOOST_CONCEPT_ASSERT(( CImage< MImage > ));
+
+    const Z2i::Domain domain(Z2i::Point(1,1), Z2i::Point(20,10));
+    VImage image(domain);
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    // A header of 5 bytes followed by the values
+    const std::string filename = "testImageContainerByMappedFile.raw";
+    {
+      std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+      out.write("HEAD\n", 5);
+      out.write(reinterpret_cast<const char*>(&image[0]), image.size() * sizeof(int));
+    }
+
+    {
+      MImage mapped(filename, domain, false, 5);
+      trace.info() << mapped << endl;
+      bool ok = mapped.isValid() && !mapped.isCopyOnWrite();
+      for (Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+        ok = ok && (mapped(*it) == image(*it));
+      MImage::ConstRange r = mapped.constRange();
+      ok = ok && std::equal(r.begin(), r.end(), image.begin());
+      ok = ok && (*r.begin(Z2i::Point(3,2)) == image(Z2i::Point(3,2)));
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << "read-only values" << endl;
+    }
+
+    {
+      MImage mapped(filename, domain, true, 5);
+      MImage copy(mapped);
+      mapped.setValue(Z2i::Point(3,2), -1);
+      MImage::Range r = mapped.range();
+      *r.begin(Z2i::Point(4,2)) = -2;
+      MImage assigned(filename, domain, false, 5);
+      assigned = mapped;
+      assigned.setValue(Z2i::Point(5,2), -3);
+      MImage reloaded(filename, domain, false, 5);
+      nbok += ( (mapped(Z2i::Point(3,2)) == -1) && (mapped(Z2i::Point(5,2)) == image(Z2i::Point(5,2)))
+                && (copy(Z2i::Point(3,2)) == image(Z2i::Point(3,2)))
+                && (copy(Z2i::Point(4,2)) == image(Z2i::Point(4,2)))
+                && (assigned(Z2i::Point(4,2)) == -2) && (assigned(Z2i::Point(5,2)) == -3)
+                && (reloaded(Z2i::Point(3,2)) == image(Z2i::Point(3,2)))
+                && (reloaded(Z2i::Point(4,2)) == image(Z2i::Point(4,2))) ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << "copy-on-write values, independent copies, file unchanged" << endl;
+    }
+
+    bool thrown = false;
+    try
+      {
+        MImage mapped(filename, Z2i::Domain(Z2i::Point(1,1), Z2i::Point(20,11)), false, 5);
+      }
+    catch (IOException &)
+      {
+        thrown = true;
+      }
+    nbok += thrown ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "file too small" << endl;
+
+    std::remove(filename.c_str());
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+bool testMappedReaders()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing RawReader::mapRaw8 and VolReader::mapVol");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> VImage2;
+    typedef ImageContainerByMappedFile<Z2i::Domain, unsigned char> MImage2;
+    const std::string rawFilename = testPath + "samples/raw2D-64x64.raw";
+    VImage2 raw = RawReader<VImage2>::importRaw8(rawFilename, Z2i::Vector(16,16));
+    MImage2 mappedRaw = RawReader<MImage2>::mapRaw8(rawFilename, Z2i::Vector(16,16));
+    trace.info() << mappedRaw << endl;
+    nbok += ( (mappedRaw.domain().upperBound() == raw.domain().upperBound())
+              && std::equal(raw.begin(), raw.end(), mappedRaw.begin()) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "raw file" << endl;
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> VImage3;
+    typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MImage3;
+    const std::string volFilename = testPath + "samples/cat10.vol";
+    VImage3 vol = VolReader<VImage3>::importVol(volFilename);
+    MImage3 mappedVol = VolReader<MImage3>::mapVol(volFilename);
+    trace.info() << mappedVol << endl;
+    bool ok = (mappedVol.domain().upperBound() == vol.domain().upperBound());
+    for (Z3i::Domain::ConstIterator it = vol.domain().begin(), itEnd = vol.domain().end(); ok && (it != itEnd); ++it)
+      ok = (mappedVol(*it) == vol(*it));
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "vol file" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+    trace.beginBlock ( "Testing class ImageContainerByMappedFile" );
+    trace.info() << "Args:";
+    for ( int i = 0; i < argc; ++i )
+        trace.info() << " " << argv[ i ];
+    trace.info() << endl;
+
+    bool res = testMappedFile() && testMappedReaders(); // && ... other tests
+
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
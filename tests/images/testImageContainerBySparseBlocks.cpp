@@ -0,0 +1,157 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerBySparseBlocks.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * @brief A test file for ImageContainerBySparseBlocks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySparseBlocks.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerBySparseBlocks.
+///////////////////////////////////////////////////////////////////////////////
+bool testImageContainerBySparseBlocks()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ImageContainerBySparseBlocks");
+
+    typedef ImageContainerBySTLMap<Z3i::Domain, int> MImage;
+    typedef ImageSelector<Z3i::Domain, int, SPARSE_I>::Type SImage;
+    BOOST_CONCEPT_ASSERT(( CImage< SImage > ));
+    BOOST_STATIC_ASSERT(( boost::is_same< SImage, ImageContainerBySparseBlocks<Z3i::Domain, int> >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< ImageSelector<Z3i::Domain, int, SPARSE_I+VTKIMAGEDATA_CONTAINER_I+LOW_ITER_I>::Type,
+                          SImage >::value ));
+
+    // 4x2x3 blocks of 8^3 points, the last ones being cut by the domain
+    const Z3i::Domain domain(Z3i::Point(-3,2,1), Z3i::Point(26,12,17));
+    MImage image(domain, -1);
+    SImage sparse(domain, -1);
+    nbok += ( sparse.isValid() && (sparse.nbBlocks() == 24) && (sparse.nbAllocatedBlocks() == 0)
+              && (sparse.nbActivePoints() == 0) && (sparse(Z3i::Point(0,5,7)) == -1)
+              && (sparse.activeBegin() == sparse.activeEnd()) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "empty image" << endl;
+
+    // A ball and a few isolated points
+    int i = 0;
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      if ( ((*it) - Z3i::Point(2,6,5)).norm() <= 3.5 )
+        {
+          image.setValue(*it, ++i);
+          sparse.setValue(*it, i);
+        }
+    image.setValue(Z3i::Point(26,12,17), 100);
+    sparse.setValue(Z3i::Point(26,12,17), 100);
+    image.setValue(Z3i::Point(25,2,1), 0);
+    sparse.setValue(Z3i::Point(25,2,1), 0);
+    trace.info() << sparse << endl;
+
+    bool ok = sparse.isValid() && (sparse.nbActivePoints() == static_cast<unsigned int>(i) + 2)
+      && (sparse.nbAllocatedBlocks() < sparse.nbBlocks());
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      ok = ok && (sparse(*it) == image(*it));
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "values" << endl;
+
+    // Active points: each one once, with its value
+    std::map<Z3i::Point, int> visited;
+    for (SImage::ActiveConstIterator it = sparse.activeBegin(), itEnd = sparse.activeEnd(); it != itEnd; ++it)
+      {
+        ok = ok && domain.isInside(it.point()) && (*it != -1) && (*it == image(it.point()))
+          && (visited.find(it.point()) == visited.end());
+        visited[ it.point() ] = *it;
+      }
+    nbok += ( ok && (visited.size() == sparse.nbActivePoints()) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "active points" << endl;
+
+    // Copy, then the blocks are freed when their values are reset
+    SImage copy(sparse);
+    const unsigned int nbBlocks = sparse.nbAllocatedBlocks();
+    sparse.setValue(Z3i::Point(26,12,17), -1);
+    sparse.setValue(Z3i::Point(25,2,1), -1);
+    sparse.setValue(Z3i::Point(25,2,1), -1);
+    ok = sparse.isValid() && (sparse.nbAllocatedBlocks() == nbBlocks - 2)
+      && (copy.nbAllocatedBlocks() == nbBlocks) && (copy(Z3i::Point(26,12,17)) == 100);
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      sparse.setValue(*it, -1);
+    ok = ok && sparse.isValid() && (sparse.nbAllocatedBlocks() == 0) && (sparse.nbActivePoints() == 0);
+    sparse = copy;
+    ok = ok && sparse.isValid() && (sparse.nbAllocatedBlocks() == nbBlocks) && (sparse(Z3i::Point(25,2,1)) == 0);
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "copy and freed blocks" << endl;
+
+    // Ranges follow the domain order
+    MImage other(domain, -1);
+    SImage::ConstRange r = sparse.constRange();
+    std::copy(r.begin(), r.end(), other.range().outputIterator());
+    SImage back(domain, -1);
+    MImage::ConstRange rm = other.constRange();
+    std::copy(rm.begin(), rm.end(), back.range().outputIterator());
+    nbok += ( (other(Z3i::Point(26,12,17)) == 100) && (other(Z3i::Point(2,6,5)) == image(Z3i::Point(2,6,5)))
+              && (back.nbActivePoints() == sparse.nbActivePoints()) && back.isValid() ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "ranges" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+    trace.beginBlock ( "Testing class ImageContainerBySparseBlocks" );
+    trace.info() << "Args:";
+    for ( int i = 0; i < argc; ++i )
+        trace.info() << " " << argv[ i ];
+    trace.info() << endl;
+
+    bool res = testImageContainerBySparseBlocks(); // && ... other tests
+
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
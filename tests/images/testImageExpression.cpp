@@ -0,0 +1,174 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageExpression.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * @brief A test file for ImageExpression.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <functional>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageExpression.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageExpression.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Domain functor which reflects the points along the first axis.
+ */
+struct Reflection
+{
+  Reflection( const Z2i::Domain & aDomain ): myDomain( aDomain ) {}
+  Z2i::Point operator()( const Z2i::Point & aPoint ) const
+  {
+    return Z2i::Point( myDomain.lowerBound()[0] + myDomain.upperBound()[0] - aPoint[0], aPoint[1] );
+  }
+  Z2i::Domain myDomain;
+};
+
+bool testImageExpression()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ImageExpression");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+    typedef ImageContainerBySTLMap<Z2i::Domain, int> MapImage;
+
+    // lines longer than the chunks of the expressions
+    const Z2i::Domain domain(Z2i::Point(-5,2), Z2i::Point(310,20));
+    Image a(domain), b(domain);
+    MapImage m(domain, 3);
+    int i = 0;
+    for (Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it, ++i)
+      {
+        a.setValue(*it, (i * 37) % 101 - 20);
+        b.setValue(*it, (*it)[0] - 2 * (*it)[1]);
+        if ( i % 7 == 0 )
+          m.setValue(*it, i % 13);
+      }
+
+    // c = 2a + b - m
+    typedef std::binder1st< std::multiplies<int> > Twice;
+    Image c(domain);
+    materialize( transformExpression( imageExpression( a ), Twice( std::multiplies<int>(), 2 ) )
+                 + imageExpression( b ) - imageExpression( m ), c );
+    bool ok = true;
+    for (Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      ok = ok && ( c(*it) == 2 * a(*it) + b(*it) - m(*it) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "fused arithmetic" << endl;
+
+    // expressions are images: point values and ranges
+    typedef BinaryImageExpression< TerminalImageExpression<Image>, TerminalImageExpression<Image>,
+                                   std::multiplies<int> > Product;
+    BOOST_CONCEPT_ASSERT(( CConstImage< Product > ));
+    Product product = imageExpression( a ) * imageExpression( b );
+    Product::ConstRange r = product.constRange();
+    Image d(domain);
+    std::copy( r.begin(), r.end(), d.range().outputIterator() );
+    ok = ( product(Z2i::Point(7,9)) == a(Z2i::Point(7,9)) * b(Z2i::Point(7,9)) );
+    for (Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      ok = ok && ( d(*it) == a(*it) * b(*it) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "values and ranges" << endl;
+
+    // adapters: identity domain functor (spans) or not, on a subdomain
+    DefaultFunctor df;
+    Thresholder<int> t( 10 );
+    typedef ConstImageAdapter<Image, Z2i::Domain, DefaultFunctor, bool, Thresholder<int> > Thresholded;
+    Thresholded thresholded( a, domain, df, t );
+    Reflection reflection( domain );
+    typedef ConstImageAdapter<Image, Z2i::Domain, Reflection, int, DefaultFunctor > Reflected;
+    Reflected reflected( b, domain, reflection, df );
+    const Z2i::Domain subDomain(Z2i::Point(0,5), Z2i::Point(290,11));
+    Image e(subDomain);
+    MapImage f(subDomain);
+    materialize( transformExpression( imageExpression( thresholded ), imageExpression( reflected ),
+                                      std::multiplies<int>() ), e );
+    materialize( imageExpression( e ), f );
+    ok = true;
+    for (Z2i::Domain::ConstIterator it = subDomain.begin(), itEnd = subDomain.end(); it != itEnd; ++it)
+      {
+        const int expected = ( a(*it) <= 10 ) ? b( reflection(*it) ) : 0;
+        ok = ok && ( e(*it) == expected ) && ( f(*it) == expected );
+      }
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "adapters and subdomain" << endl;
+
+    // bool values, packed by std::vector<bool>
+    typedef ImageContainerBySTLVector<Z2i::Domain, bool> BoolImage;
+    BoolImage boolImage(subDomain), notBoolImage(subDomain);
+    materialize( imageExpression( thresholded ), boolImage );
+    materialize( transformExpression( imageExpression( boolImage ), std::logical_not<bool>() ),
+                 notBoolImage );
+    ok = true;
+    for (Z2i::Domain::ConstIterator it = subDomain.begin(), itEnd = subDomain.end(); it != itEnd; ++it)
+      ok = ok && ( boolImage(*it) == ( a(*it) <= 10 ) ) && ( notBoolImage(*it) == ( a(*it) > 10 ) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "bool values" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+    trace.beginBlock ( "Testing class ImageExpression" );
+    trace.info() << "Args:";
+    for ( int i = 0; i < argc; ++i )
+        trace.info() << " " << argv[ i ];
+    trace.info() << endl;
+
+    bool res = testImageExpression(); // && ... other tests
+
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 #include "DGtal/images/ImageFactoryFromHDF5.h"
 #include "DGtal/images/ImageCache.h"
 #include "DGtal/images/TiledImage.h"
+#include "DGtal/io/readers/HDF5Reader.h"
+#include "DGtal/io/writers/HDF5Writer.h"
 
 #include "ConfigTest.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -582,6 +584,79 @@ bool testTiledImage3D_double()
     return nbok == nb;
 }
 
+#define H5FILE_NAME_3D_CHUNKED   "testImageFactoryFromHDF5_CHUNKED_3D.h5"
+#define DATASETNAME_3D_CHUNKED   "UInt8Array3D"
+
+bool testChunkedHDF5_3D()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing chunked HDF5 writing and reading (3D)");
+
+    typedef ImageSelector<Z3i::Domain, DGtal::uint8_t>::Type Image;
+
+    Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(39,31,23));
+    Image image(domain);
+    for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it)
+      image.setValue(*it, ((*it)[0] + 3*(*it)[1] + 7*(*it)[2]) % 251);
+
+    // Chunks aligned with the tiles of a TiledImage with 4 tiles per dimension.
+    Z3i::Vector chunk(10,8,6);
+    bool written = HDF5Writer<Image>::exportHDF5_3D(H5FILE_NAME_3D_CHUNKED, image, DATASETNAME_3D_CHUNKED, chunk);
+    nbok += written ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") write" << endl;
+
+    Image read = HDF5Reader<Image>::importHDF5_3D(H5FILE_NAME_3D_CHUNKED, DATASETNAME_3D_CHUNKED);
+    nbok += ( read.domain().upperBound() == domain.upperBound()
+              && std::equal(image.begin(), image.end(), read.begin()) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") read" << endl;
+
+    typedef ImageFactoryFromHDF5<Image> MyImageFactoryFromHDF5;
+    MyImageFactoryFromHDF5 factImage(H5FILE_NAME_3D_CHUNKED, DATASETNAME_3D_CHUNKED);
+
+    // Hyperslab which is not aligned with the chunks
+    Z3i::Domain subDomain(Z3i::Point(3,5,7), Z3i::Point(29,20,17));
+    MyImageFactoryFromHDF5::OutputImage *subImage = factImage.requestImage(subDomain);
+    bool same = true;
+    for(Z3i::Domain::ConstIterator it = subDomain.begin(), itend = subDomain.end(); it != itend; ++it)
+      same = same && ( (*subImage)(*it) == image(*it) );
+    factImage.detachImage(subImage);
+    nbok += same ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") unaligned hyperslab" << endl;
+
+    typedef MyImageFactoryFromHDF5::OutputImage OutputImage;
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromHDF5> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromHDF5> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(factImage, 4);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(factImage);
+
+    typedef TiledImage<Image, MyImageFactoryFromHDF5, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWT> MyTiledImage;
+    MyTiledImage tiledImage(factImage, imageCacheReadPolicyFIFO, imageCacheWritePolicyWT, 4);
+
+    same = true;
+    for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end(); it != itend; ++it)
+      same = same && ( tiledImage(*it) == image(*it) );
+    nbok += same ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") tiled image" << endl;
+
+    // Write through the tiled image then read the chunks again.
+    tiledImage.setValue(Z3i::Point(12,9,7), 3);
+    subImage = factImage.requestImage(Z3i::Domain(Z3i::Point(10,8,6), Z3i::Point(19,15,11)));
+    nbok += ( (*subImage)(Z3i::Point(12,9,7)) == 3 ) ? 1 : 0;
+    nb++;
+    factImage.detachImage(subImage);
+    trace.info() << "(" << nbok << "/" << nb << ") write and read back" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -602,6 +677,8 @@ int main( int argc, char** argv )
     res = res && writeHDF5_3D_TILED();
     res = res && testTiledImage3D_double();
 
+    res = res && testChunkedHDF5_3D();
+
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
     return res ? 0 : 1;
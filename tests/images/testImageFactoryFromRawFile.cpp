@@ -0,0 +1,180 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageFactoryFromRawFile.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageFactoryFromRawFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromRawFile.h"
+#include "DGtal/images/TiledImage.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageFactoryFromRawFile.
+///////////////////////////////////////////////////////////////////////////////
+bool testImageFactoryFromRawFile()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ImageFactoryFromRawFile");
+
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    typedef ImageFactoryFromRawFile<VImage> MyImageFactory;
+    Z2i::Domain domain(Z2i::Point(1,1), Z2i::Point(16,16));
+
+    {
+      MyImageFactory factory(domain, "testImageFactoryFromRawFile.raw");
+      trace.info() << factory << endl;
+      nbok += factory.isValid() ? 1 : 0;
+      nb++;
+
+      //Fresh file is filled with zeros
+      VImage *image = factory.requestImage(Z2i::Domain(Z2i::Point(3,2), Z2i::Point(7,9)));
+      nbok += (image->domain().size() == 40 && (*image)(Z2i::Point(5,5)) == 0) ? 1 : 0;
+      nb++;
+      factory.detachImage(image);
+
+      //Write the whole image in two flushes
+      VImage *left = factory.requestImage(Z2i::Domain(Z2i::Point(1,1), Z2i::Point(8,16)));
+      VImage *right = factory.requestImage(Z2i::Domain(Z2i::Point(9,1), Z2i::Point(16,16)));
+      for (Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it)
+        {
+          int v = (*it)[0] + 100 * (*it)[1];
+          if ((*it)[0] <= 8)
+            left->setValue(*it, v);
+          else
+            right->setValue(*it, v);
+        }
+      factory.flushImage(left);
+      factory.flushImage(right);
+      factory.detachImage(left);
+      factory.detachImage(right);
+
+      image = factory.requestImage(Z2i::Domain(Z2i::Point(6,4), Z2i::Point(12,5)));
+      nbok += ((*image)(Z2i::Point(6,4)) == 406 && (*image)(Z2i::Point(12,5)) == 512) ? 1 : 0;
+      nb++;
+      factory.detachImage(image);
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+
+    {
+      //Reopening the existing file, through a TiledImage
+      MyImageFactory factory(domain, "testImageFactoryFromRawFile.raw", false, true);
+
+      typedef ImageCacheReadPolicyFIFO<VImage, MyImageFactory> MyReadPolicy;
+      typedef ImageCacheWritePolicyWB<VImage, MyImageFactory> MyWritePolicy;
+      MyReadPolicy readPolicy(factory, 2);
+      MyWritePolicy writePolicy(factory);
+      typedef TiledImage<VImage, MyImageFactory, MyReadPolicy, MyWritePolicy> MyTiledImage;
+      BOOST_CONCEPT_ASSERT(( CImage< MyTiledImage > ));
+      MyTiledImage tiledImage(factory, readPolicy, writePolicy, 4);
+
+      bool ok = true;
+      for (Z2i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it)
+        ok = ok && (tiledImage(*it) == (*it)[0] + 100 * (*it)[1]);
+      nbok += ok ? 1 : 0;
+      nb++;
+
+      //Written values are kept when tiles leave the cache
+      tiledImage.setValue(Z2i::Point(2,2), -1);
+      tiledImage(Z2i::Point(16,16));
+      tiledImage(Z2i::Point(16,1));
+      tiledImage(Z2i::Point(1,16));
+      nbok += (tiledImage(Z2i::Point(2,2)) == -1) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+
+    {
+      //Errors: a file too small is kept, a file which cannot be created is not left
+      {
+        std::ofstream small("testImageFactoryFromRawFile-small.raw", std::ios::binary);
+        small.put('\0');
+      }
+      bool thrown = false;
+      try
+        {
+          MyImageFactory factory(domain, "testImageFactoryFromRawFile-small.raw", false);
+        }
+      catch (IOException &)
+        {
+          thrown = true;
+        }
+      std::ifstream kept("testImageFactoryFromRawFile-small.raw");
+      nbok += (thrown && kept.is_open()) ? 1 : 0;
+      nb++;
+      kept.close();
+      std::remove("testImageFactoryFromRawFile-small.raw");
+
+      thrown = false;
+      try
+        {
+          MyImageFactory factory(domain, "testImageFactoryFromRawFile-missing/file.raw");
+        }
+      catch (IOException &)
+        {
+          thrown = true;
+        }
+      nbok += thrown ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageFactoryFromRawFile" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImageFactoryFromRawFile(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTiledImage-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Raster sweep of a 3D TiledImage with the LAST, FIFO, LRU and
+ * NEIGHBORS read policies: time, hits and misses. Then, mean of the
+ * 6-neighbors computed point by point and with processTiles.
+ *
+ * Usage: testTiledImage-benchmark [size] [N] [cache size]
+ * (default: 128^3 image, 8 tiles per dimension, 64 pages).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TiledImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+typedef ImageFactoryFromImage<Image> Factory;
+typedef Factory::OutputImage OutputImage;
+typedef ImageCacheWritePolicyWT<OutputImage, Factory> WritePolicy;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the read policies of TiledImage.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Raster sweep of a tiled image.
+ * @return 'true' if the sum of the values is the expected one.
+ */
+template <typename TReadPolicy>
+bool sweep( const std::string & aName, Factory & aFactory, TReadPolicy & aReadPolicy,
+            const int N, const Image & anImage, const long long aSum )
+{
+  typedef TiledImage<Image, Factory, TReadPolicy, WritePolicy> Tiled;
+  WritePolicy writePolicy( aFactory );
+  Tiled tiled( aFactory, aReadPolicy, writePolicy, N );
+
+  Clock c;
+  c.startClock();
+  long long sum = 0;
+  for ( Z3i::Domain::ConstIterator it = anImage.domain().begin(), itEnd = anImage.domain().end();
+        it != itEnd; ++it )
+    sum += tiled( *it );
+  const double time = c.stopClock();
+
+  trace.info() << aName << ": " << time << " ms, "
+               << tiled.getCacheHitRead() << " hits, "
+               << tiled.getCacheMissRead() << " misses" << std::endl;
+  return sum == aSum;
+}
+
+/**
+ * Tile functor: mean of the 6-neighbors (inside the domain of the
+ * input tile) of the points of the result tile.
+ */
+struct MeanFunctor
+{
+  template <typename TInput, typename TOutput>
+  void operator()( const TInput & anInput, TOutput & aResult ) const
+  {
+    const Z3i::Domain & domain = anInput.domain();
+    for ( Z3i::Domain::ConstIterator it = aResult.domain().begin(), itEnd = aResult.domain().end();
+          it != itEnd; ++it )
+      {
+        int sum = 0, nb = 0;
+        for ( Dimension k = 0; k < 3; ++k )
+          for ( int d = -1; d <= 1; d += 2 )
+            {
+              Z3i::Point q = *it;
+              q[ k ] += d;
+              if ( domain.isInside( q ) )
+                {
+                  sum += anInput( q );
+                  nb++;
+                }
+            }
+        aResult.setValue( *it, sum / nb );
+      }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking the read policies of TiledImage" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[1] ) : 128;
+  const int N = ( argc > 2 ) ? atoi( argv[2] ) : 8;
+  const int cacheSize = ( argc > 3 ) ? atoi( argv[3] ) : 64;
+
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  long long sum = 0;
+  int v = 0;
+  for ( Image::Iterator it = image.begin(), itEnd = image.end(); it != itEnd; ++it )
+    {
+      *it = v++ % 255;
+      sum += *it;
+    }
+  trace.info() << image << ", " << N << " tiles per dimension, "
+               << cacheSize << " pages" << std::endl;
+
+  Factory factory( image );
+  ImageCacheReadPolicyLAST<OutputImage, Factory> last( factory );
+  ImageCacheReadPolicyFIFO<OutputImage, Factory> fifo( factory, cacheSize );
+  ImageCacheReadPolicyLRU<OutputImage, Factory> lru( factory, cacheSize );
+  ImageCacheReadPolicyNEIGHBORS<OutputImage, Factory> neighbors( factory, N, 2 * cacheSize );
+
+  bool res = sweep( "LAST", factory, last, N, image, sum );
+  res = sweep( "FIFO", factory, fifo, N, image, sum ) && res;
+  res = sweep( "LRU", factory, lru, N, image, sum ) && res;
+  res = sweep( "NEIGHBORS (twice the pages)", factory, neighbors, N, image, sum ) && res;
+  trace.info() << neighbors.getNbPrefetched() << " pages prefetched" << std::endl;
+
+  typedef ImageCacheReadPolicyLRU<OutputImage, Factory> ReadPolicyLRU;
+  typedef TiledImage<Image, Factory, ReadPolicyLRU, WritePolicy> Tiled;
+  WritePolicy writePolicy( factory );
+  ReadPolicyLRU lruFilter( factory, cacheSize );
+  Tiled tiled( factory, lruFilter, writePolicy, N );
+  Clock c;
+  Image pointByPoint( image.domain() );
+  c.startClock();
+  MeanFunctor()( tiled, pointByPoint );
+  trace.info() << "Mean, point by point: " << c.stopClock() << " ms" << std::endl;
+
+  Image byTiles( image.domain() );
+  c.startClock();
+  tiled.processTiles( MeanFunctor(), byTiles, 1 );
+  trace.info() << "Mean, processTiles: " << c.stopClock() << " ms" << std::endl;
+  for ( Image::ConstIterator it = byTiles.begin(), itEnd = byTiles.end(), itRef = pointByPoint.begin();
+        res && ( it != itEnd ); ++it, ++itRef )
+    res = ( *it == *itRef );
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
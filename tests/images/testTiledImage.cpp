@@ -325,6 +325,219 @@ bool test_range_constRange()
     return nbok == nb;
 }
 
+/**
+ * Raster sweep of a 3D TiledImage with a given read policy.
+ * @return 'true' if all the values are read correctly and if each
+ * read is either a hit or a miss.
+ */
+template <typename TTiledImage, typename TImage>
+bool rasterSweep(TTiledImage & tiledImage, const TImage & image)
+{
+    bool ok = true;
+    for (typename TImage::Domain::ConstIterator it = image.domain().begin(), itEnd = image.domain().end(); it != itEnd; ++it)
+      ok = ok && (tiledImage(*it) == image(*it));
+    
+    trace.info() << "read hits: " << tiledImage.getCacheHitRead() << " - read misses: " << tiledImage.getCacheMissRead() << endl;
+    
+    return ok && (tiledImage.getCacheHitRead() + tiledImage.getCacheMissRead() == image.domain().size());
+}
+
+bool testReadPolicies()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing LRU and NEIGHBORS read policies with TiledImage");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    VImage image(Z3i::Domain(Z3i::Point(1,1,1), Z3i::Point(16,16,16)));
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheReadPolicyNEIGHBORS<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyNEIGHBORS;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(imageFactoryFromImage, 4);
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 4);
+    MyImageCacheReadPolicyNEIGHBORS imageCacheReadPolicyNEIGHBORS(imageFactoryFromImage, 4, 40);
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT(imageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWT> MyTiledImageFIFO;
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWT> MyTiledImageLRU;
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyNEIGHBORS, MyImageCacheWritePolicyWT> MyTiledImageNEIGHBORS;
+    BOOST_CONCEPT_ASSERT(( CImage< MyTiledImageLRU > ));
+    BOOST_CONCEPT_ASSERT(( CImage< MyTiledImageNEIGHBORS > ));
+    MyTiledImageFIFO tiledImageFIFO(imageFactoryFromImage, imageCacheReadPolicyFIFO, imageCacheWritePolicyWT, 4);
+    MyTiledImageLRU tiledImageLRU(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWT, 4);
+    MyTiledImageNEIGHBORS tiledImageNEIGHBORS(imageFactoryFromImage, imageCacheReadPolicyNEIGHBORS, imageCacheWritePolicyWT, 4);
+
+    // The first tile is read again before a fifth tile is loaded:
+    // LRU keeps it in the cache, FIFO detaches it as the oldest one.
+    Z3i::Point a(1,1,1), b(5,1,1), c(9,1,1), d(13,1,1), e(1,5,1);
+    tiledImageFIFO(a); tiledImageFIFO(b); tiledImageFIFO(c); tiledImageFIFO(d); tiledImageFIFO(a); tiledImageFIFO(e); tiledImageFIFO(a);
+    tiledImageLRU(a); tiledImageLRU(b); tiledImageLRU(c); tiledImageLRU(d); tiledImageLRU(a); tiledImageLRU(e); tiledImageLRU(a);
+    trace.info() << "FIFO read misses: " << tiledImageFIFO.getCacheMissRead() << " - LRU read misses: " << tiledImageLRU.getCacheMissRead() << endl;
+    nbok += ( (tiledImageFIFO.getCacheMissRead() == 6) && (tiledImageLRU.getCacheMissRead() == 5)
+              && (tiledImageLRU.getCacheHitRead() == 2) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    tiledImageLRU.clearCacheAndResetCacheMisses();
+    nbok += ( (tiledImageLRU.getCacheHitRead() == 0) && (tiledImageLRU.getCacheMissRead() == 0) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // Raster sweeps: a slice of 4x4 tiles is read for each z, the LRU
+    // policy with 16 pages loads each tile once and the NEIGHBORS
+    // policy (with room for the prefetched tiles of the next slice)
+    // misses less as it prefetches the next tiles.
+    MyImageCacheReadPolicyFIFO sweepReadPolicyFIFO(imageFactoryFromImage, 16);
+    MyImageCacheReadPolicyLRU sweepReadPolicyLRU(imageFactoryFromImage, 16);
+    MyTiledImageFIFO sweepFIFO(imageFactoryFromImage, sweepReadPolicyFIFO, imageCacheWritePolicyWT, 4);
+    MyTiledImageLRU sweepLRU(imageFactoryFromImage, sweepReadPolicyLRU, imageCacheWritePolicyWT, 4);
+
+    nbok += ( rasterSweep(sweepFIFO, image) && (sweepFIFO.getCacheMissRead() == 64) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    nbok += ( rasterSweep(sweepLRU, image) && (sweepLRU.getCacheMissRead() == 64) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    nbok += ( rasterSweep(tiledImageNEIGHBORS, image)
+              && (tiledImageNEIGHBORS.getCacheMissRead() < sweepLRU.getCacheMissRead()) ) ? 1 : 0;
+    nb++;
+    trace.info() << "prefetched: " << imageCacheReadPolicyNEIGHBORS.getNbPrefetched() << endl;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    // The prefetched tiles are also used with the block coords.
+    tiledImageNEIGHBORS.clearCacheAndResetCacheMisses();
+    tiledImageNEIGHBORS.findTileFromBlockCoords(Z3i::Point(1,1,1));
+    tiledImageNEIGHBORS.findTileFromBlockCoords(Z3i::Point(2,1,1));
+    tiledImageNEIGHBORS.findTileFromBlockCoords(Z3i::Point(1,0,1));
+    nbok += ( (tiledImageNEIGHBORS.getCacheMissRead() == 1) && (tiledImageNEIGHBORS.getCacheHitRead() == 2)
+              && (imageCacheReadPolicyNEIGHBORS.getNbPrefetched() == 6) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+/**
+ * Tile functor: mean of the 6-neighbors (inside the domain of the
+ * input tile) of the points of the result tile.
+ */
+struct MeanFunctor
+{
+    template <typename TImage>
+    void operator()(const TImage & anInput, TImage & aResult) const
+    {
+      const Z3i::Domain & domain = anInput.domain();
+      for (Z3i::Domain::ConstIterator it = aResult.domain().begin(), itEnd = aResult.domain().end(); it != itEnd; ++it)
+      {
+        int sum = 0, nb = 0;
+        for (Dimension k = 0; k < 3; ++k)
+          for (int d = -1; d <= 1; d += 2)
+          {
+            Z3i::Point q = *it;
+            q[k] += d;
+            if (domain.isInside(q))
+            {
+              sum += anInput(q);
+              nb++;
+            }
+          }
+        aResult.setValue(*it, sum / nb);
+      }
+    }
+};
+
+bool testProcessTiles()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing processTiles with TiledImage");
+
+    typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+    const Z3i::Domain domain(Z3i::Point(1,1,1), Z3i::Point(30,30,30));
+    VImage image(domain);
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++ % 97;
+    VImage outImage(domain);
+
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    MyImageFactoryFromImage outImageFactoryFromImage(outImage);
+
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU(imageFactoryFromImage, 4);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+    MyImageCacheReadPolicyLRU outImageCacheReadPolicyLRU(outImageFactoryFromImage, 8);
+    MyImageCacheWritePolicyWB outImageCacheWritePolicyWB(outImageFactoryFromImage);
+
+    typedef TiledImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyTiledImage;
+    // 4 tiles of 7 values and a last tile of 2 values for each dimension
+    MyTiledImage tiledImage(imageFactoryFromImage, imageCacheReadPolicyLRU, imageCacheWritePolicyWB, 4);
+    MyTiledImage tiledOutImage(outImageFactoryFromImage, outImageCacheReadPolicyLRU, outImageCacheWritePolicyWB, 4);
+
+    nbok += ( tiledImage.domainBlockCoords().upperBound() == Z3i::Point(4,4,4) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "block coords" << endl;
+
+    // A value not flushed yet (write-back) is seen by processTiles
+    VImage copy(image);
+    tiledImage.setValue(Z3i::Point(7,7,7), 1000);
+    copy.setValue(Z3i::Point(7,7,7), 1000);
+
+    VImage reference(domain);
+    MeanFunctor mean;
+    mean(copy, reference);
+
+    tiledImage.processTiles(mean, tiledOutImage, 1);
+    trace.info() << tiledImage << endl;
+    bool ok = true;
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      ok = ok && (tiledOutImage(*it) == reference(*it));
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "mean with a halo of 1, in a TiledImage" << endl;
+
+    // One tile per batch, sequentially, in a VImage
+    VImage result(domain);
+    tiledImage.processTiles(mean, result, 1, 1, false);
+    ok = true;
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      ok = ok && (result(*it) == reference(*it));
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "mean with a halo of 1, one tile per batch" << endl;
+
+    // Without halo, the tiles are processed independently
+    tiledImage.processTiles(mean, result);
+    Z3i::Point p(7,3,3), q(8,3,3);
+    nbok += ( (result(p) == (copy(Z3i::Point(6,3,3)) + copy(Z3i::Point(7,2,3)) + copy(Z3i::Point(7,4,3))
+                             + copy(Z3i::Point(7,3,2)) + copy(Z3i::Point(7,3,4))) / 5)
+              && (result(q) != reference(q)) ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "mean without halo" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -336,7 +549,7 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d() && testIterators() && test_range_constRange(); // && ... other tests
+    bool res = testSimple() && test3d() && testIterators() && test_range_constRange() && testReadPolicies() && testProcessTiles(); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
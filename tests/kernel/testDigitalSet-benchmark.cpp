@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSet-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Insertions, membership tests, iterations and removals on sparse
+ * point clouds and on a dense ball with the different models of
+ * CDigitalSet.
+ *
+ * Usage: testDigitalSet-benchmark [nbPoints] (default: 1000000). The
+ * linear time DigitalSetBySTLVector is only run on nbPoints/100
+ * points.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByHashTable.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the models of CDigitalSet.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Inserts, searches (half of the queries are misses), iterates and
+ * removes the points of @a points in a set of type TSet.
+ * @return a checksum of the results.
+ */
+template <typename TSet>
+unsigned long runASet( const std::string &aName,
+                       const Z3i::Domain &aDomain,
+                       const std::vector<Z3i::Point> &points,
+                       const std::vector<Z3i::Point> &queries )
+{
+  trace.beginBlock( aName );
+  TSet set( aDomain );
+  unsigned long checksum = 0;
+
+  trace.beginBlock( "Insertions" );
+  for ( std::vector<Z3i::Point>::const_iterator it = points.begin(), itEnd = points.end();
+        it != itEnd; ++it )
+    set.insert( *it );
+  double t = trace.endBlock();
+  trace.info() << "  " << points.size() / ( t * 1000.0 ) << " M/s" << std::endl;
+
+  trace.beginBlock( "Membership tests" );
+  for ( std::vector<Z3i::Point>::const_iterator it = queries.begin(), itEnd = queries.end();
+        it != itEnd; ++it )
+    checksum += set( *it ) ? 1 : 0;
+  t = trace.endBlock();
+  trace.info() << "  " << queries.size() / ( t * 1000.0 ) << " M/s" << std::endl;
+
+  trace.beginBlock( "Iteration" );
+  for ( typename TSet::ConstIterator it = set.begin(), itEnd = set.end(); it != itEnd; ++it )
+    checksum += (*it)[0] & 1;
+  trace.endBlock();
+
+  trace.beginBlock( "Removals (half of the points)" );
+  for ( std::size_t i = 0; i < points.size(); i += 2 )
+    checksum += set.erase( points[ i ] );
+  t = trace.endBlock();
+  trace.info() << "  " << points.size() / ( 2 * t * 1000.0 ) << " M/s, "
+               << set << std::endl;
+
+  trace.endBlock();
+  return checksum;
+}
+
+bool runABenchmark( const unsigned int nbPoints )
+{
+  //sparse points in a large domain
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 4095 ) );
+  srand( 0 );
+  std::vector<Z3i::Point> points, queries;
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    {
+      Z3i::Point p( rand() % 4096, rand() % 4096, rand() % 4096 );
+      points.push_back( p );
+      queries.push_back( p );
+      queries.push_back( Z3i::Point( rand() % 4096, rand() % 4096, rand() % 4096 ) );
+    }
+  const std::vector<Z3i::Point> smallPoints( points.begin(), points.begin() + nbPoints / 100 );
+  const std::vector<Z3i::Point> smallQueries( queries.begin(), queries.begin() + nbPoints / 50 );
+
+  trace.info() << nbPoints << " points in " << domain << std::endl;
+  const unsigned long c1 = runASet< DigitalSetBySTLSet<Z3i::Domain> >
+    ( "DigitalSetBySTLSet", domain, points, queries );
+  const unsigned long c2 = runASet< DigitalSetByHashTable<Z3i::Domain> >
+    ( "DigitalSetByHashTable", domain, points, queries );
+
+  trace.info() << nbPoints / 100 << " points in " << domain << std::endl;
+  const unsigned long c3 = runASet< DigitalSetBySTLVector<Z3i::Domain> >
+    ( "DigitalSetBySTLVector", domain, smallPoints, smallQueries );
+  const unsigned long c4 = runASet< DigitalSetByHashTable<Z3i::Domain> >
+    ( "DigitalSetByHashTable", domain, smallPoints, smallQueries );
+
+  return ( c1 == c2 ) && ( c3 == c4 );
+}
+
+/**
+ * Union of two shifted balls: @return the size of the union.
+ */
+template <typename TSet>
+unsigned long runAUnion( const std::string &aName,
+                         const Z3i::Domain &aDomain,
+                         const std::vector<Z3i::Point> &ball,
+                         const Z3i::Vector &shift )
+{
+  TSet set1( aDomain ), set2( aDomain );
+  for ( std::vector<Z3i::Point>::const_iterator it = ball.begin(), itEnd = ball.end();
+        it != itEnd; ++it )
+    {
+      set1.insertNew( *it );
+      set2.insertNew( *it + shift );
+    }
+  trace.beginBlock( aName + " union" );
+  set1 += set2;
+  trace.endBlock();
+  return set1.size();
+}
+
+bool runADenseBenchmark()
+{
+  //a ball filling a large part of the domain
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 255 ) );
+  const Z3i::Point center = Z3i::Point::diagonal( 120 );
+  const Z3i::Vector shift( 8, 8, 8 );
+  std::vector<Z3i::Point> ball, queries;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( ( *it - center ).dot( *it - center ) <= 100 * 100 )
+      ball.push_back( *it );
+  srand( 0 );
+  for ( std::size_t i = 0; i < ball.size(); ++i )
+    queries.push_back( Z3i::Point( rand() % 256, rand() % 256, rand() % 256 ) );
+
+  trace.info() << ball.size() << " points of a ball in " << domain << std::endl;
+  const unsigned long c1 = runASet< DigitalSetBySTLSet<Z3i::Domain> >
+    ( "DigitalSetBySTLSet", domain, ball, queries );
+  const unsigned long c2 = runASet< DigitalSetByBitVector<Z3i::Domain> >
+    ( "DigitalSetByBitVector", domain, ball, queries );
+  const unsigned long u1 = runAUnion< DigitalSetBySTLSet<Z3i::Domain> >
+    ( "DigitalSetBySTLSet", domain, ball, shift );
+  const unsigned long u2 = runAUnion< DigitalSetByBitVector<Z3i::Domain> >
+    ( "DigitalSetByBitVector", domain, ball, shift );
+  trace.info() << "Memory: DigitalSetByBitVector " << domain.size() / ( 8 << 20 )
+               << " MB, DigitalSetBySTLSet about "
+               << ball.size() * ( sizeof( Z3i::Point ) + 4 * sizeof( void* ) ) / ( 1 << 20 )
+               << " MB" << std::endl;
+  return ( c1 == c2 ) && ( u1 == u2 );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking the models of CDigitalSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const unsigned int nbPoints = ( argc > 1 ) ? atoi( argv[1] ) : 1000000;
+  bool res = runABenchmark( nbPoints ) && runADenseBenchmark();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
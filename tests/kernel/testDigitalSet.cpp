@@ -50,6 +50,8 @@
 #include "DGtal/kernel/domains/CDomainArchetype.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByHashTable.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -358,6 +360,190 @@ bool testDigitalSetDomain()
   return nbok == nb;
 }
 
+/**
+ * Random insertions and removals in a DigitalSetByHashTable (with
+ * table growths and many erased slots), compared with a
+ * DigitalSetBySTLSet.
+ */
+bool testDigitalSetByHashTable()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Random insertions/removals in DigitalSetByHashTable" );
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  Domain domain( Point( -20, -10, -5 ), Point( 20, 10, 5 ) );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< DigitalSetByHashTable<Domain> > ));
+  DigitalSetByHashTable<Domain> set( domain );
+  DigitalSetBySTLSet<Domain> reference( domain );
+
+  srand( 0 );
+  bool ok = true;
+  for ( unsigned int i = 0; i < 50000; ++i )
+    {
+      Point p( rand() % 41 - 20, rand() % 21 - 10, rand() % 11 - 5 );
+      if ( rand() % 3 == 0 )
+        ok = ok && ( set.erase( p ) == reference.erase( p ) );
+      else
+        {
+          set.insert( p );
+          reference.insert( p );
+        }
+    }
+  for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( set( *it ) == reference( *it ) )
+      && ( ( set.find( *it ) == set.end() ) || ( *set.find( *it ) == *it ) );
+  INBLOCK_TEST2( ok && ( set.size() == reference.size() ) && set.isValid(),
+                 "Same points as DigitalSetBySTLSet: " << set );
+
+  DigitalSetByHashTable<Domain> copy( set );
+  copy.erase( copy.begin(), copy.begin() + copy.size() / 2 );
+  Point lower, upper, lower2, upper2;
+  set.computeBoundingBox( lower, upper );
+  reference.computeBoundingBox( lower2, upper2 );
+  INBLOCK_TEST2( ( copy.size() == set.size() - set.size() / 2 )
+                 && ( lower == lower2 ) && ( upper == upper2 ),
+                 "Range erasure and bounding box" );
+
+  set.clear();
+  set.reserve( 1000 );
+  INBLOCK_TEST2( set.empty() && set.isValid() && ( set.find( lower ) == set.end() ),
+                 "Cleared set: " << set );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Random insertions and removals in a DigitalSetByBitVector, compared
+ * with a DigitalSetBySTLSet, then word-level set operations.
+ */
+bool testDigitalSetByBitVector()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Random insertions/removals in DigitalSetByBitVector" );
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitVector<Domain> BitSet;
+  //41*21*11 bits: the last word is not full
+  Domain domain( Point( -20, -10, -5 ), Point( 20, 10, 5 ) );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< BitSet > ));
+  BitSet set( domain ), set2( domain );
+  DigitalSetBySTLSet<Domain> reference( domain ), reference2( domain );
+
+  srand( 0 );
+  bool ok = true;
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      Point p( rand() % 41 - 20, rand() % 21 - 10, rand() % 11 - 5 );
+      if ( rand() % 3 == 0 )
+        ok = ok && ( set.erase( p ) == reference.erase( p ) );
+      else
+        {
+          set.insert( p );
+          reference.insert( p );
+        }
+      Point q( rand() % 41 - 20, rand() % 21 - 10, rand() % 11 - 5 );
+      set2.insert( q );
+      reference2.insert( q );
+    }
+  for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( set( *it ) == reference( *it ) )
+      && ( ( set.find( *it ) == set.end() ) || ( *set.find( *it ) == *it ) );
+  INBLOCK_TEST2( ok && ( set.size() == reference.size() ) && set.isValid(),
+                 "Same points as DigitalSetBySTLSet: " << set );
+
+  //forward and backward iterations in the domain order
+  std::vector<Point> inDomainOrder, forward, backward;
+  for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( reference( *it ) )
+      inDomainOrder.push_back( *it );
+  for ( BitSet::ConstIterator it = set.begin(), itEnd = set.end(); it != itEnd; ++it )
+    forward.push_back( *it );
+  for ( BitSet::ConstIterator it = set.end(), itBegin = set.begin(); it != itBegin; )
+    backward.push_back( *--it );
+  std::reverse( backward.begin(), backward.end() );
+  INBLOCK_TEST2( ( forward == inDomainOrder ) && ( backward == inDomainOrder ),
+                 "Forward and backward iterations" );
+
+  //word-level operations
+  BitSet unionSet( set ), interSet( set ), diffSet( set ), complSet( domain );
+  unionSet += set2;
+  interSet &= set2;
+  diffSet -= set2;
+  complSet.assignFromComplement( set );
+  ok = unionSet.isValid() && interSet.isValid() && diffSet.isValid()
+    && complSet.isValid()
+    && ( complSet.size() == domain.size() - set.size() );
+  for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const bool in1 = reference( *it );
+      const bool in2 = reference2( *it );
+      ok = ok && ( unionSet( *it ) == ( in1 || in2 ) )
+        && ( interSet( *it ) == ( in1 && in2 ) )
+        && ( diffSet( *it ) == ( in1 && ! in2 ) )
+        && ( complSet( *it ) == ! in1 );
+    }
+  INBLOCK_TEST2( ok, "Union, intersection, difference and complement: "
+                 << unionSet << " " << interSet << " " << diffSet << " " << complSet );
+
+  //translations, with points outside of the domain in or out of the set
+  ok = true;
+  const Point shifts[] = { Point( 1, 0, 0 ), Point( -1, 0, 0 ), Point( 0, 1, 0 ),
+                           Point( -3, 2, -1 ), Point( 40, -20, 10 ), Point( 41, 0, 0 ),
+                           Point( 0, 0, 11 ) };
+  BitSet translated( domain );
+  for ( unsigned int i = 0; i < 7; ++i )
+    for ( unsigned int outside = 0; outside < 2; ++outside )
+      {
+        translated.assignFromTranslation( set, shifts[ i ], outside == 1 );
+        ok = ok && translated.isValid();
+        for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+          {
+            const Point q = *it + shifts[ i ];
+            ok = ok && ( translated( *it )
+                         == ( domain.isInside( q ) ? reference( q ) : ( outside == 1 ) ) );
+          }
+      }
+  INBLOCK_TEST2( ok, "Translations: " << translated );
+
+  //operations between sets of different domains
+  Domain subDomain( Point( -3, -4, -5 ), Point( 7, 3, 2 ) );
+  BitSet subSet( subDomain );
+  for ( Domain::ConstIterator it = subDomain.begin(), itEnd = subDomain.end(); it != itEnd; ++it )
+    subSet.insert( *it );
+  BitSet clipped( set );
+  clipped &= subSet;
+  ok = clipped.isValid();
+  for ( Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( clipped( *it ) == ( reference( *it ) && subDomain.isInside( *it ) ) );
+  INBLOCK_TEST2( ok, "Intersection with a set of a subdomain: " << clipped );
+
+  BitSet copy( set );
+  BitSet::ConstIterator itMiddle = copy.begin();
+  for ( unsigned int i = 0; i < copy.size() / 2; ++i )
+    ++itMiddle;
+  copy.erase( copy.begin(), itMiddle );
+  Point lower, upper, lower2, upper2;
+  set.computeBoundingBox( lower, upper );
+  reference.computeBoundingBox( lower2, upper2 );
+  INBLOCK_TEST2( ( copy.size() == set.size() - set.size() / 2 ) && copy.isValid()
+                 && ( *copy.begin() == inDomainOrder[ set.size() / 2 ] )
+                 && ( lower == lower2 ) && ( upper == upper2 ),
+                 "Range erasure and bounding box" );
+
+  set.clear();
+  INBLOCK_TEST2( set.empty() && set.isValid() && ( set.begin() == set.end() )
+                 && ( set.find( lower ) == set.end() ),
+                 "Cleared set: " << set );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 bool testDigitalSetConcept()
 {
   BOOST_CONCEPT_ASSERT(( CDigitalSet<Z2i::DigitalSet> ));
@@ -399,6 +585,18 @@ int main()
     ( DigitalSetBySTLSet<Domain>(domain), DigitalSetBySTLSet<Domain>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByHashTable" );
+  bool okHashTable = testDigitalSet< DigitalSetByHashTable<Domain> >
+    ( DigitalSetByHashTable<Domain>(domain), DigitalSetByHashTable<Domain>(domain) )
+    && testDigitalSetByHashTable();
+  trace.endBlock();
+
+  trace.beginBlock( "DigitalSetByBitVector" );
+  bool okBitVector = testDigitalSet< DigitalSetByBitVector<Domain> >
+    ( DigitalSetByBitVector<Domain>(domain), DigitalSetByBitVector<Domain>(domain) )
+    && testDigitalSetByBitVector();
+  trace.endBlock();
+
   trace.beginBlock( "DigitalSetFromMap" );
   typedef ImageContainerBySTLMap<Domain,short int> Map; 
   Map map(domain); Map map2(domain);        //maps
@@ -419,14 +617,23 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorBigHVarHBel = testDigitalSetSelector
+      < Domain, BIG_DS + HIGH_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Big set + High variability + High belonging test" );
+
+  bool okSelectorWholeHBel = testDigitalSetSelector
+      < Domain, WHOLE_DS + LOW_VAR_DS + HIGH_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Whole domain + High belonging test" );
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet && okMap 
+  bool res = okVector && okSet && okHashTable && okBitVector && okMap 
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
+      && okSelectorBigHVarHBel && okSelectorWholeHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -45,6 +45,8 @@
 #include "DGtal/images/ImageContainerBySTLMap.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/images/imagesSetsUtils/IntervalForegroundPredicate.h"
 
 #include "DGtal/helpers/StdDefs.h"
 
@@ -221,6 +223,105 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+bool testImageKernels()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing kernels on images stored in vectors ..." );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain,int> Image;
+  typedef ImageContainerBySTLVector<Z3i::Domain,unsigned char> Mask;
+  Z3i::Domain d(Z3i::Point(-2,1,3), Z3i::Point(13,9,10));
+  Image image(d);
+  Image image2(d);
+  int i = 0;
+  for (Z3i::Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it, ++i)
+    {
+      image.setValue(*it, (i * 37) % 101 - 20);
+      image2.setValue(*it, (*it)[0] - (*it)[2]);
+    }
+
+  //sets: same points as with the predicates
+  Z3i::DigitalSet aSet(d);
+  DigitalSetInserter<Z3i::DigitalSet> inserter(aSet);
+  setFromImage( image, inserter, 30 );
+  Z3i::DigitalSet aSet2(d);
+  DigitalSetInserter<Z3i::DigitalSet> inserter2(aSet2);
+  setFromImage( image, inserter2, -5, 30 );
+  bool ok = ( aSet.size() > 0 ) && ( aSet2.size() > 0 );
+  unsigned int nb1 = 0, nb2 = 0;
+  for (Z3i::Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    {
+      nb1 += ( image(*it) <= 30 ) ? 1 : 0;
+      nb2 += ( image(*it) >= -5 && image(*it) <= 30 ) ? 1 : 0;
+      ok = ok && ( ( image(*it) <= 30 ) == ( aSet.find(*it) != aSet.end() ) )
+	&& ( ( image(*it) >= -5 && image(*it) <= 30 ) == ( aSet2.find(*it) != aSet2.end() ) );
+    }
+  nbok += ( ok && (aSet.size() == nb1) && (aSet2.size() == nb2) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") sets" << std::endl;
+
+  //masks
+  Mask mask(d), mask2(d);
+  maskFromImage( image, mask, 10 );
+  maskFromImage( image, mask2, -5, 30, (unsigned char)255 );
+  SimpleThresholdForegroundPredicate<Image> simple( image, 10 );
+  IntervalForegroundPredicate<Image> interval( image, -5, 30 );
+  ok = true;
+  for (Z3i::Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    ok = ok && ( mask(*it) == ( simple(*it) ? 1 : 0 ) ) && ( mask2(*it) == ( interval(*it) ? 255 : 0 ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") masks" << std::endl;
+
+  //arithmetic, min/max, rescale
+  Image sum(d), neg(d);
+  transformImage( image, image2, sum, std::plus<int>() );
+  transformImage( image, neg, std::negate<int>() );
+  int mn = 0, mx = 0;
+  imageMinMax( image, mn, mx );
+  ImageContainerBySTLVector<Z3i::Domain,double> scaled(d);
+  rescaleImage( image, scaled, 0.5, 1.0 );
+  ok = ( mn == -20 ) && ( mx == 80 );
+  for (Z3i::Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    ok = ok && ( sum(*it) == image(*it) + image2(*it) ) && ( neg(*it) == -image(*it) )
+      && ( scaled(*it) == 0.5 * image(*it) + 1.0 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") arithmetic, min/max, rescale" << std::endl;
+
+  //histogram of the values in [-20,79], one bin per 10 values
+  std::vector<unsigned int> histogram(10);
+  imageHistogram( image, -20, 79, histogram );
+  std::vector<unsigned int> expected(10, 0);
+  for (Z3i::Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    if ( image(*it) < 80 )
+      expected[ ( image(*it) + 20 ) / 10 ]++;
+  nbok += ( histogram == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") histogram" << std::endl;
+
+  //empty images
+  Image empty(d), emptyOut(d);
+  Mask emptyMask(d);
+  empty.clear();
+  emptyOut.clear();
+  emptyMask.clear();
+  maskFromImage( empty, emptyMask, 10 );
+  transformImage( empty, emptyOut, std::negate<int>() );
+  transformImage( empty, empty, emptyOut, std::plus<int>() );
+  imageHistogram( empty, -20, 79, histogram );
+  nbok += ( ( empty.size() == 0 )
+	    && ( histogram == std::vector<unsigned int>(10, 0) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") empty images" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -232,7 +333,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage() && testImageKernels();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
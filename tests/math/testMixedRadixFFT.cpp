@@ -0,0 +1,157 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMixedRadixFFT.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MixedRadixFFT.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MixedRadixFFT.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef MixedRadixFFT::Complex Complex;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MixedRadixFFT.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return a pseudo-random sequence of @a n complex values.
+ */
+std::vector< Complex > randomSequence( const unsigned int n )
+{
+  std::vector< Complex > values( n );
+  for ( unsigned int i = 0; i < n; ++i )
+    values[ i ] = Complex( ( rand() % 1000 ) / 100.0 - 5.0, ( rand() % 1000 ) / 100.0 - 5.0 );
+  return values;
+}
+
+/**
+ * @return the maximal difference between the MixedRadixFFT forward
+ * transform of a random sequence and its direct DFT.
+ */
+double compareWithDFT( const unsigned int n )
+{
+  std::vector< Complex > input = randomSequence( n );
+  std::vector< Complex > output( n );
+  MixedRadixFFT fft( n );
+  fft.transform( &input[ 0 ], &output[ 0 ], false );
+
+  double error = 0.0;
+  for ( unsigned int k = 0; k < n; ++k )
+    {
+      Complex sum( 0.0, 0.0 );
+      for ( unsigned int j = 0; j < n; ++j )
+        {
+          const double angle = -2.0 * M_PI * static_cast< double >( ( j * k ) % n ) / static_cast< double >( n );
+          sum += input[ j ] * Complex( std::cos( angle ), std::sin( angle ) );
+        }
+      error = std::max( error, std::abs( sum - output[ k ] ) );
+    }
+  return error;
+}
+
+bool testMixedRadixFFT()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing goodSize ..." );
+  nbok += ( MixedRadixFFT::goodSize( 1 ) == 1 ) ? 1 : 0;
+  nb++;
+  nbok += ( MixedRadixFFT::goodSize( 7 ) == 8 ) ? 1 : 0;
+  nb++;
+  nbok += ( MixedRadixFFT::goodSize( 97 ) == 100 ) ? 1 : 0;
+  nb++;
+  nbok += ( MixedRadixFFT::goodSize( 281 ) == 288 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing 1D transforms against the direct DFT ..." );
+  const unsigned int sizes[] = { 1, 2, 3, 4, 5, 8, 12, 30, 45, 64, 100, 360 };
+  for ( unsigned int i = 0; i < sizeof( sizes ) / sizeof( unsigned int ); ++i )
+    {
+      const double error = compareWithDFT( sizes[ i ] );
+      trace.info() << "size " << sizes[ i ] << " " << MixedRadixFFT( sizes[ i ] )
+                   << " error=" << error << std::endl;
+      nbok += ( error < 1e-9 * sizes[ i ] ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing 3D forward and backward transforms ..." );
+  std::vector< unsigned int > extents( 3 );
+  extents[ 0 ] = 12; extents[ 1 ] = 5; extents[ 2 ] = 18;
+  std::vector< Complex > values = randomSequence( 12 * 5 * 18 );
+  std::vector< Complex > transformed = values;
+  MixedRadixFFT::transform( transformed, extents, false );
+
+  /// The DC component is the sum of the values
+  Complex sum( 0.0, 0.0 );
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    sum += values[ i ];
+  nbok += ( std::abs( transformed[ 0 ] - sum ) < 1e-8 ) ? 1 : 0;
+  nb++;
+
+  MixedRadixFFT::transform( transformed, extents, true );
+  double error = 0.0;
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    error = std::max( error, std::abs( transformed[ i ] - values[ i ] ) );
+  trace.info() << "inverse error=" << error << std::endl;
+  nbok += ( error < 1e-10 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MixedRadixFFT" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMixedRadixFFT();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
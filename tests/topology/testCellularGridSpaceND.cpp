@@ -491,6 +491,109 @@ bool testCellularGridSpaceNDCoFaces()
   return nb == nbok;
 }
 
+template <typename KSpace>
+bool testCellKeysAndHashContainers()
+{
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::CellKey CellKey;
+  typedef KhalimskySpaceND< KSpace::dimension, Integer,
+                            KhalimskyHashContainers > HashKSpace;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing packed cell keys ..." );
+  KSpace K;
+  int xlow[ 4 ] = { -3, -2, -2, -1 };
+  int xhigh[ 4 ] = { 5, 3, 2, 3 };
+  Point low( xlow );
+  Point high( xhigh );
+  K.init( low, high, true );
+  nbok += K.hasCellKeys() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "K.hasCellKeys()" << std::endl;
+  CellKey nbcells = 1;
+  for ( Dimension i = 0; i < K.dimension; ++i )
+    nbcells *= 2 * K.size( i ) + 1;
+  unsigned int nbroundtrips = 0;
+  for ( CellKey key = 0; key < nbcells; ++key )
+    {
+      const Cell c = K.uCellFromKey( key );
+      const SCell pos = K.sCellFromKey( 2 * key + 1 );
+      bool ok = ( K.uKey( c ) == key ) 
+        && ( K.sKey( pos ) == 2 * key + 1 ) 
+        && ( K.sKey( K.sOpp( pos ) ) == 2 * key )
+        && ( K.unsigns( pos ) == c ) && ( K.sSign( pos ) == K.POS );
+      for ( Dimension i = 0; i < K.dimension; ++i )
+        ok = ok && ( K.lowerCell().myCoordinates[ i ] <= K.uKCoord( c, i ) )
+          && ( K.uKCoord( c, i ) <= K.upperCell().myCoordinates[ i ] );
+      nbroundtrips += ok ? 1 : 0;
+    }
+  nbok += nbroundtrips == nbcells ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbroundtrips << " key round trips == "
+               << nbcells << " cells." << std::endl;
+  KSpace Kinvalid( K );
+  const Point huge = Point::diagonal( NumberTraits<Integer>::max() - 1 );
+  const Cell upperCell = K.upperCell();
+  nbok += ( ! Kinvalid.init( low, huge, false ) )
+    && Kinvalid.isSpaceClosed() && ( Kinvalid.upperBound() == high )
+    && ( Kinvalid.upperCell() == upperCell ) && Kinvalid.hasCellKeys()
+    && ( Kinvalid.uKey( upperCell ) == nbcells - 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "an invalid init leaves the space unchanged" << std::endl;
+  KSpace Kdefault;
+  nbok += ( KSpace::dimension == 2 ) || ! Kdefault.hasCellKeys() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no keys for the default (huge) space in dimension > 2" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing hashed cell containers ..." );
+  typedef SpaceND< KSpace::dimension, Integer > Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point::zero, 2 );
+  HashKSpace HK;
+  HK.init( low, high, true );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  const SCell start = Surfaces<KSpace>::findABel( K, shape_set, 1000 );
+  typename KSpace::SurfelSet bdry;
+  Surfaces<KSpace>::trackBoundary( bdry, K, SAdj, shape_set, start );
+  typename HashKSpace::SurfelSet hbdry;
+  Surfaces<HashKSpace>::trackBoundary( hbdry, HK, SAdj, shape_set, start );
+  unsigned int nbfound = 0;
+  for ( typename KSpace::SurfelSet::const_iterator it = bdry.begin(), 
+          itE = bdry.end(); it != itE; ++it )
+    nbfound += hbdry.count( *it );
+  nbok += ( bdry.size() == hbdry.size() ) && ( nbfound == bdry.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << hbdry.size() << " hashed surfels == " 
+               << bdry.size() << " ordered surfels." << std::endl;
+  typename HashKSpace::template CellMap<CellKey>::Type keys;
+  for ( typename KSpace::SurfelSet::const_iterator it = bdry.begin(), 
+          itE = bdry.end(); it != itE; ++it )
+    keys[ K.unsigns( *it ) ] = K.uKey( K.unsigns( *it ) );
+  unsigned int nbkeys = 0;
+  for ( typename HashKSpace::template CellMap<CellKey>::Type::const_iterator 
+          it = keys.begin(), itE = keys.end(); it != itE; ++it )
+    nbkeys += ( HK.uCellFromKey( it->second ) == it->first ) ? 1 : 0;
+  nbok += ( nbkeys == bdry.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbkeys << " hashed keys == " << bdry.size() << " surfels." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -508,6 +611,8 @@ int main( int argc, char** argv )
   BOOST_CONCEPT_ASSERT(( CCellularGridSpaceND< K2 > ));
   BOOST_CONCEPT_ASSERT(( CCellularGridSpaceND< K3 > ));
   BOOST_CONCEPT_ASSERT(( CCellularGridSpaceND< K4 > ));
+  typedef KhalimskySpaceND<3, DGtal::int32_t, KhalimskyHashContainers> HK3;
+  BOOST_CONCEPT_ASSERT(( CCellularGridSpaceND< HK3 > ));
 
   bool res = testCellularGridSpaceND<K2>()
     && testCellularGridSpaceND<K3>()
@@ -522,7 +627,11 @@ int main( int argc, char** argv )
     && testCellularGridSpaceNDFaces<K4>()
     && testCellularGridSpaceNDCoFaces<K2>()
     && testCellularGridSpaceNDCoFaces<K3>()
-    && testCellularGridSpaceNDCoFaces<K4>();
+    && testCellularGridSpaceNDCoFaces<K4>()
+    && testSurfelAdjacency<HK3>()
+    && testCellKeysAndHashContainers<K2>()
+    && testCellKeysAndHashContainers<K3>()
+    && testCellKeysAndHashContainers<K4>();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -0,0 +1,116 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Connected components of random 3D volumes with 6, 18 and 26
+ * connectivities: Object::writeComponents versus
+ * ConnectedComponentLabelling (sequential and parallel).
+ *
+ * Usage: testConnectedComponentLabelling-benchmark [size] [density]
+ * (default: 96^3 volume, 30% of object points).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TObject>
+bool runABenchmark( const std::string & aName,
+                    const typename TObject::DigitalTopology & aTopology,
+                    const Z3i::DigitalSet & aSet )
+{
+  trace.beginBlock( aName );
+  TObject object( aTopology, aSet );
+
+  trace.beginBlock( "Object::writeComponents" );
+  std::vector<TObject> components;
+  std::back_insert_iterator< std::vector<TObject> > it( components );
+  object.writeComponents( it );
+  trace.endBlock();
+
+  trace.beginBlock( "ConnectedComponentLabelling (sequential)" );
+  ConnectedComponentLabelling<TObject> sequentialLabelling( object, false );
+  trace.endBlock();
+
+  trace.beginBlock( "ConnectedComponentLabelling" );
+  ConnectedComponentLabelling<TObject> labelling( object );
+  trace.endBlock();
+
+  trace.beginBlock( "ConnectedComponentLabelling::writeComponents" );
+  std::vector<TObject> components2;
+  std::back_insert_iterator< std::vector<TObject> > it2( components2 );
+  labelling.writeComponents( it2 );
+  trace.endBlock();
+
+  trace.info() << components.size() << " components, " << labelling << std::endl;
+  trace.endBlock();
+  return ( components.size() == labelling.nbComponents() )
+    && ( components2.size() == labelling.nbComponents() )
+    && ( sequentialLabelling.nbComponents() == labelling.nbComponents() );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class ConnectedComponentLabelling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[1] ) : 96;
+  const int density = ( argc > 2 ) ? atoi( argv[2] ) : 30;
+
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 0 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( rand() % 100 < density )
+      set.insertNew( *it );
+  trace.info() << set.size() << " points in " << domain << std::endl;
+
+  bool res = runABenchmark<Z3i::Object6_18>( "6-connectivity", Z3i::dt6_18, set )
+    && runABenchmark<Z3i::Object18_6>( "18-connectivity", Z3i::dt18_6, set )
+    && runABenchmark<Z3i::Object26_6>( "26-connectivity", Z3i::dt26_6, set );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
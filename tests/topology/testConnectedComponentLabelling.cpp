@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ConnectedComponentLabelling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DomainAdjacency.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST2(x,y) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << y << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Labels a random object of the given density (in percent) and
+ * compares the components with the ones of Object::writeComponents.
+ */
+template <typename TObject>
+bool testLabelling( const std::string & aName,
+                    const typename TObject::DigitalTopology & aTopology,
+                    const typename TObject::Domain & aDomain,
+                    const int aDensity )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef TObject ObjectType;
+  typedef typename ObjectType::Domain Domain;
+  typedef typename ObjectType::DigitalSet DigitalSet;
+  typedef ConnectedComponentLabelling<ObjectType> Labelling;
+
+  trace.beginBlock ( "Labelling of a random object: " + aName );
+  DigitalSet set( aDomain );
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    if ( rand() % 100 < aDensity )
+      set.insertNew( *it );
+  ObjectType object( aTopology, set );
+
+  std::vector<ObjectType> expected;
+  std::back_insert_iterator< std::vector<ObjectType> > itExpected( expected );
+  object.writeComponents( itExpected );
+
+  Labelling labelling( object );
+  Labelling sequentialLabelling( object, false );
+  trace.info() << labelling << " " << expected.size() << " expected" << std::endl;
+  INBLOCK_TEST2( labelling.isValid()
+                 && ( labelling.nbComponents() == expected.size() )
+                 && ( sequentialLabelling.nbComponents() == expected.size() ),
+                 "Number of components: " << labelling.nbComponents() );
+
+  //each expected component has a single label, distinct from the others
+  bool ok = true;
+  std::vector<bool> used( expected.size() + 1, false );
+  for ( typename std::vector<ObjectType>::const_iterator it = expected.begin(),
+          itEnd = expected.end(); ok && ( it != itEnd ); ++it )
+    {
+      const typename Labelling::Label l = labelling.label( *it->pointSet().begin() );
+      ok = ( l != 0 ) && ( l <= expected.size() ) && ! used[ l ];
+      used[ l ] = true;
+      for ( typename DigitalSet::ConstIterator itP = it->pointSet().begin(),
+              itPEnd = it->pointSet().end(); ok && ( itP != itPEnd ); ++itP )
+        ok = ( labelling.label( *itP ) == l );
+    }
+  INBLOCK_TEST2( ok, "Same components as Object::writeComponents" );
+
+  //label image, background and sequential labelling
+  typename Labelling::LabelImage image = labelling.labelImage();
+  ok = true;
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        ok && ( it != itEnd ); ++it )
+    ok = ( image( *it ) == labelling.label( *it ) )
+      && ( image( *it ) == sequentialLabelling.label( *it ) )
+      && ( ( image( *it ) == 0 ) == ! object.pointSet()( *it ) );
+  INBLOCK_TEST2( ok, "Label image" );
+
+  //component objects
+  std::vector<ObjectType> components;
+  std::back_insert_iterator< std::vector<ObjectType> > itComponents( components );
+  ok = ( labelling.writeComponents( itComponents ) == expected.size() )
+    && ( components.size() == expected.size() );
+  typename ObjectType::Size total = 0;
+  for ( std::size_t i = 0; ok && ( i < components.size() ); ++i )
+    {
+      total += components[ i ].size();
+      ok = ( components[ i ].connectedness() == CONNECTED )
+        && ( labelling.label( *components[ i ].pointSet().begin() ) == i + 1 );
+    }
+  ok = ok && ( total == object.size() );
+  for ( std::size_t i = 0; ok && ( i < expected.size() ); ++i )
+    ok = ( expected[ i ].size()
+           == components[ labelling.label( *expected[ i ].pointSet().begin() ) - 1 ].size() );
+  INBLOCK_TEST2( ok, "Component objects" );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Labelling of an empty object and of an object filling a thin domain.
+ */
+bool testSpecialCases()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Special cases" );
+  typedef ConnectedComponentLabelling<Z3i::Object26_6> Labelling;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 9, 0, 7 ) );
+  Z3i::DigitalSet set( domain );
+  Z3i::Object26_6 empty( Z3i::dt26_6, set );
+  Labelling emptyLabelling( empty );
+  INBLOCK_TEST2( emptyLabelling.nbComponents() == 0, "Empty object: " << emptyLabelling );
+
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( ( (*it)[ 0 ] + (*it)[ 2 ] ) % 2 == 0 )
+      set.insertNew( *it );
+  Z3i::Object26_6 checkerboard26( Z3i::dt26_6, set );
+  Z3i::Object6_26 checkerboard6( Z3i::dt6_26, set );
+  Labelling labelling26( checkerboard26 );
+  ConnectedComponentLabelling<Z3i::Object6_26> labelling6( checkerboard6 );
+  INBLOCK_TEST2( ( labelling26.nbComponents() == 1 ) && ( labelling6.nbComponents() == set.size() ),
+                 "Flat checkerboard: " << labelling26.nbComponents() << " and "
+                 << labelling6.nbComponents() << " components" );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConnectedComponentLabelling" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  Z2i::Domain domain2( Z2i::Point( -20, -15 ), Z2i::Point( 21, 16 ) );
+  Z3i::Domain domain3( Z3i::Point( -8, -6, -5 ), Z3i::Point( 9, 7, 12 ) );
+
+  typedef MetricAdjacency< Z3i::Space, 1 > MetricAdj6;
+  typedef MetricAdjacency< Z3i::Space, 3 > MetricAdj26;
+  typedef DomainAdjacency< Z3i::Domain, MetricAdj6 > DomainAdj6;
+  typedef DomainAdjacency< Z3i::Domain, MetricAdj26 > DomainAdj26;
+  typedef DigitalTopology< DomainAdj6, DomainAdj26 > DomainDT6_26;
+  MetricAdj6 madj6;
+  MetricAdj26 madj26;
+  DomainAdj6 adj6( domain3, madj6 );
+  DomainAdj26 adj26( domain3, madj26 );
+  DomainDT6_26 domainDT6_26( adj6, adj26, JORDAN_DT );
+
+  bool res = testLabelling<Z2i::Object4_8>( "4-8", Z2i::dt4_8, domain2, 55 )
+    && testLabelling<Z2i::Object8_4>( "8-4", Z2i::dt8_4, domain2, 40 )
+    && testLabelling<Z3i::Object6_18>( "6-18", Z3i::dt6_18, domain3, 30 )
+    && testLabelling<Z3i::Object18_6>( "18-6", Z3i::dt18_6, domain3, 15 )
+    && testLabelling<Z3i::Object26_6>( "26-6", Z3i::dt26_6, domain3, 10 )
+    && testLabelling< Object<DomainDT6_26, Z3i::DigitalSet> >
+    ( "6-26 (DomainAdjacency)", domainDT6_26, domain3, 30 )
+    && testSpecialCases();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
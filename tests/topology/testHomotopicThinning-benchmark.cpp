@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHomotopicThinning-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Homotopic thinning of a 3D torus: loop over Object::isSimple (as
+ * in homotopicThinning3D.cpp) versus HomotopicThinning (directional
+ * and by distance, sequential and parallel), in points removed per
+ * second.
+ *
+ * Usage: testHomotopicThinning-benchmark [size]
+ * (default: 64^3 volume).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <queue>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HomotopicThinning.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class HomotopicThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Reference thinning, removing the simple points with Object::isSimple.
+ * @return the number of removed points.
+ */
+unsigned int referenceThinning( Z3i::Object26_6 & anObject )
+{
+  unsigned int nbRemoved = 0;
+  unsigned int nbSimple;
+  Z3i::DigitalSet & set = anObject.pointSet();
+  do
+    {
+      std::queue<Z3i::Point> candidates;
+      for ( Z3i::DigitalSet::ConstIterator it = set.begin(), itEnd = set.end(); it != itEnd; ++it )
+        if ( anObject.isSimple( *it ) )
+          candidates.push( *it );
+      nbSimple = 0;
+      while ( ! candidates.empty() )
+        {
+          if ( anObject.isSimple( candidates.front() ) )
+            {
+              set.erase( candidates.front() );
+              ++nbSimple;
+            }
+          candidates.pop();
+        }
+      nbRemoved += nbSimple;
+    }
+  while ( nbSimple != 0 );
+  return nbRemoved;
+}
+
+void report( const std::string & aName, const double aTime,
+             const unsigned int aNbRemoved, const unsigned int aSize )
+{
+  trace.info() << aName << ": " << aNbRemoved << " points removed in " << aTime
+               << " ms (" << 1000.0 * aNbRemoved / aTime << " points/s), "
+               << aSize << " points left" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef HomotopicThinning<Z3i::Object26_6> Thinning;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+
+  trace.beginBlock ( "Benchmarking class HomotopicThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[1] ) : 64;
+  const double R = 0.3 * size;
+  const double r = 0.15 * size;
+  Z3i::Domain domain( Z3i::Point::diagonal( -size / 2 ), Z3i::Point::diagonal( size / 2 ) );
+  Z3i::DigitalSet torus( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const double x = (*it)[ 0 ], y = (*it)[ 1 ], z = (*it)[ 2 ];
+      const double d = std::sqrt( x * x + y * y ) - R;
+      if ( d * d + z * z <= r * r )
+        torus.insertNew( *it );
+    }
+  trace.info() << torus.size() << " points in " << domain << std::endl;
+
+  Clock c;
+  Z3i::Object26_6 reference( Z3i::dt26_6, torus );
+  c.startClock();
+  const unsigned int nbReference = referenceThinning( reference );
+  report( "Object::isSimple loop", c.stopClock(), nbReference, reference.size() );
+
+  Z3i::Object26_6 sequential( Z3i::dt26_6, torus );
+  Thinning sequentialThinning( sequential, false );
+  sequentialThinning.thinDirectional();
+  report( "Directional (sequential)", sequentialThinning.time(),
+          sequentialThinning.nbRemoved(), sequential.size() );
+
+  Z3i::Object26_6 directional( Z3i::dt26_6, torus );
+  Thinning thinning( directional );
+  thinning.thinDirectional();
+  report( "Directional", thinning.time(), thinning.nbRemoved(), directional.size() );
+
+  L2Metric l2;
+  DT dt( &domain, &torus, &l2 );
+  Z3i::Object26_6 medial( Z3i::dt26_6, torus );
+  Thinning medialThinning( medial );
+  medialThinning.setEndPointPreservation( true );
+  medialThinning.thinByPriority( dt );
+  report( "By distance, end points preserved", medialThinning.time(),
+          medialThinning.nbRemoved(), medial.size() );
+
+  const bool res = ( sequential.size() == directional.size() );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
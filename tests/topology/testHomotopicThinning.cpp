@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHomotopicThinning.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class HomotopicThinning.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HomotopicThinning.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST2(x,y) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << y << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HomotopicThinning.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the numbers of connected components of the object and of
+ * its complement in the domain.
+ */
+template <typename TObject>
+std::pair<typename TObject::Size, typename TObject::Size>
+nbComponents( const TObject & anObject )
+{
+  typedef typename TObject::ComplementObject ComplementObject;
+  typename TObject::DigitalSet complementSet( anObject.pointSet().domain() );
+  complementSet.assignFromComplement( anObject.pointSet() );
+  ComplementObject complement( anObject.topology().reverseTopology(), complementSet );
+  ConnectedComponentLabelling<TObject> labelling( anObject );
+  ConnectedComponentLabelling<ComplementObject> complementLabelling( complement );
+  return std::make_pair( labelling.nbComponents(), complementLabelling.nbComponents() );
+}
+
+/**
+ * @return 'true' if no point of the thinned object can be removed.
+ */
+template <typename TObject>
+bool isThin( const HomotopicThinning<TObject> & aThinning )
+{
+  const typename TObject::DigitalSet & set = aThinning.object().pointSet();
+  for ( typename TObject::DigitalSet::ConstIterator it = set.begin(), itEnd = set.end();
+        it != itEnd; ++it )
+    if ( aThinning.isRemovable( *it ) )
+      return false;
+  return true;
+}
+
+/**
+ * Thins a shape with the different strategies and checks that the
+ * topology is preserved.
+ */
+template <typename TObject>
+bool testThinning( const std::string & aName,
+                   const typename TObject::DigitalTopology & aTopology,
+                   const typename TObject::DigitalSet & aSet )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef TObject ObjectType;
+  typedef typename ObjectType::DigitalSet DigitalSet;
+  typedef typename ObjectType::Domain Domain;
+  typedef typename ObjectType::Size Size;
+  typedef typename ObjectType::Space Space;
+  typedef HomotopicThinning<ObjectType> Thinning;
+  typedef ExactPredicateLpSeparableMetric<Space, 2> L2Metric;
+  typedef DistanceTransformation<Space, DigitalSet, L2Metric> DT;
+
+  trace.beginBlock ( "Thinning: " + aName );
+  const std::pair<Size, Size> expected = nbComponents( ObjectType( aTopology, aSet ) );
+  trace.info() << aSet.size() << " points, " << expected.first << " component(s), "
+               << expected.second << " in the complement" << std::endl;
+
+  ObjectType directional( aTopology, aSet );
+  Thinning thinning( directional );
+  thinning.thinDirectional();
+  trace.info() << thinning << " " << directional.size() << " points left" << std::endl;
+  INBLOCK_TEST2( thinning.isValid() && ( nbComponents( directional ) == expected )
+                 && ( thinning.nbRemoved() + directional.size() == aSet.size() ),
+                 "Directional thinning preserves the topology" );
+  INBLOCK_TEST2( isThin( thinning ), "No removable point left" );
+
+  ObjectType sequential( aTopology, aSet );
+  Thinning sequentialThinning( sequential, false );
+  sequentialThinning.thinDirectional();
+  bool ok = ( sequential.size() == directional.size() );
+  for ( typename DigitalSet::ConstIterator it = sequential.pointSet().begin(),
+          itEnd = sequential.pointSet().end(); ok && ( it != itEnd ); ++it )
+    ok = directional.pointSet()( *it );
+  INBLOCK_TEST2( ok, "Same result without parallelism" );
+
+  ObjectType curve( aTopology, aSet );
+  Thinning curveThinning( curve );
+  curveThinning.setEndPointPreservation( true );
+  curveThinning.thinDirectional();
+  INBLOCK_TEST2( ( nbComponents( curve ) == expected ) && isThin( curveThinning )
+                 && ( curve.size() >= directional.size() ),
+                 "Curve thinning preserves the topology (" << curve.size() << " points)" );
+
+  const Domain domain = aSet.domain();
+  L2Metric l2;
+  DT dt( &domain, &aSet, &l2 );
+  ObjectType medial( aTopology, aSet );
+  Thinning medialThinning( medial );
+  medialThinning.setEndPointPreservation( true );
+  medialThinning.thinByPriority( dt );
+  trace.info() << medialThinning << " " << medial.size() << " points left" << std::endl;
+  INBLOCK_TEST2( ( nbComponents( medial ) == expected ) && isThin( medialThinning ),
+                 "Thinning by distance preserves the topology" );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HomotopicThinning" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  //A disk with two holes
+  Z2i::Domain domain2( Z2i::Point( -25, -25 ), Z2i::Point( 25, 25 ) );
+  Z2i::DigitalSet disk( domain2 );
+  for ( Z2i::Domain::ConstIterator it = domain2.begin(), itEnd = domain2.end(); it != itEnd; ++it )
+    if ( ( (*it).norm() <= 20 )
+         && ( ( *it - Z2i::Point( 8, 2 ) ).norm() > 4 )
+         && ( ( *it - Z2i::Point( -7, -3 ) ).norm() > 5 ) )
+      disk.insertNew( *it );
+
+  //A ring crossed by two bars
+  Z3i::Domain domain3( Z3i::Point::diagonal( -16 ), Z3i::Point::diagonal( 16 ) );
+  Z3i::DigitalSet ring( domain3 );
+  for ( Z3i::Domain::ConstIterator it = domain3.begin(), itEnd = domain3.end(); it != itEnd; ++it )
+    if ( ( (*it).norm() <= 14 ) && ( (*it).norm() >= 8 )
+         && ( ( std::abs( (*it)[ 0 ] ) <= 3 ) || ( std::abs( (*it)[ 1 ] ) <= 3 ) ) )
+      ring.insertNew( *it );
+
+  bool res = testThinning<Z2i::Object4_8>( "4-8", Z2i::dt4_8, disk )
+    && testThinning<Z2i::Object8_4>( "8-4", Z2i::dt8_4, disk )
+    && testThinning<Z3i::Object6_26>( "6-26", Z3i::dt6_26, ring )
+    && testThinning<Z3i::Object26_6>( "26-6", Z3i::dt26_6, ring )
+    && testThinning<Z3i::Object18_6>( "18-6", Z3i::dt18_6, ring );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
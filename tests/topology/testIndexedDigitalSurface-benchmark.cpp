@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of several traversals of the neighborhoods of a digital
+ * surface, with a DigitalSurface (neighbors computed by tracking) and
+ * with an IndexedDigitalSurface (neighbors stored in CSR arrays).
+ *
+ * Usage: testIndexedDigitalSurface-benchmark [radius] [nbPasses]
+ * (default: 100 10).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class IndexedDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Euclidean ball centered at the origin.
+ */
+struct BallPredicate
+{
+  typedef Z3i::Point Point;
+
+  BallPredicate( const double aRadius )
+    : mySquaredRadius( aRadius * aRadius )
+  {}
+
+  bool operator()( const Point & p ) const
+  {
+    return (double)p[ 0 ] * p[ 0 ] + (double)p[ 1 ] * p[ 1 ]
+      + (double)p[ 2 ] * p[ 2 ] <= mySquaredRadius;
+  }
+
+  double mySquaredRadius;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::SCell SCell;
+  typedef ImplicitDigitalSurface<KSpace, BallPredicate> Container;
+  typedef DigitalSurface<Container> Surface;
+  typedef IndexedDigitalSurface<Container> IndexedSurface;
+  typedef IndexedSurface::Index Index;
+
+  trace.beginBlock ( "Benchmarking class IndexedDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int radius = ( argc > 1 ) ? atoi( argv[1] ) : 100;
+  const int nbPasses = ( argc > 2 ) ? atoi( argv[2] ) : 10;
+
+  BallPredicate ball( radius );
+  KSpace K;
+  K.init( Z3i::Point::diagonal( -radius - 2 ), Z3i::Point::diagonal( radius + 2 ), true );
+  SurfelAdjacency<3> adjacency( true );
+  const SCell start = Surfaces<KSpace>::findABel( K, ball, Z3i::Point::diagonal( 0 ),
+                                                  Z3i::Point::diagonal( radius + 1 ) );
+
+  trace.beginBlock( "Tracking the surface" );
+  Surface surface( new Container( K, ball, adjacency, start ) );
+  trace.endBlock();
+  trace.info() << surface.size() << " surfels" << std::endl;
+
+  // Sum of the degrees of the neighbors, computed nbPasses times.
+  trace.beginBlock( "DigitalSurface neighborhoods" );
+  unsigned long sum1 = 0;
+  std::vector<SCell> neighbors;
+  for ( int pass = 0; pass < nbPasses; ++pass )
+    for ( Surface::ConstIterator it = surface.begin(), itEnd = surface.end();
+          it != itEnd; ++it )
+      {
+        neighbors.clear();
+        std::back_insert_iterator< std::vector<SCell> > out = std::back_inserter( neighbors );
+        surface.writeNeighbors( out, *it );
+        for ( std::vector<SCell>::const_iterator n = neighbors.begin(), nEnd = neighbors.end();
+              n != nEnd; ++n )
+          sum1 += surface.degree( *n );
+      }
+  trace.endBlock();
+
+  trace.beginBlock( "IndexedDigitalSurface construction" );
+  IndexedSurface indexedSurface( surface );
+  trace.endBlock();
+  trace.info() << indexedSurface << std::endl;
+
+  trace.beginBlock( "IndexedDigitalSurface neighborhoods" );
+  unsigned long sum2 = 0;
+  for ( int pass = 0; pass < nbPasses; ++pass )
+    for ( Index v = 0; v < indexedSurface.size(); ++v )
+      for ( IndexedSurface::IndexConstIterator n = indexedSurface.neighborsBegin( v ),
+              nEnd = indexedSurface.neighborsEnd( v ); n != nEnd; ++n )
+        sum2 += indexedSurface.degree( *n );
+  trace.endBlock();
+
+  trace.beginBlock( "Faces" );
+  trace.info() << surface.allFaces().size() << " faces (DigitalSurface)" << std::endl;
+  trace.info() << indexedSurface.nbFaces() << " faces (IndexedDigitalSurface)" << std::endl;
+  trace.endBlock();
+
+  const bool res = ( sum1 == sum2 ) && ( indexedSurface.size() == surface.size() );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,231 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class IndexedDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CConstSinglePassRange.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/graph/CUndirectedSimpleLocalGraph.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IndexedDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Compares an IndexedDigitalSurface with the DigitalSurface built on
+ * the same container: vertices, neighbors, arcs and faces.
+ */
+template <typename KSpace>
+bool testIndexedDigitalSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  std::string msg( "Testing block ... IndexedDigitalSurface in K" );
+  msg += '0' + KSpace::dimension;
+  trace.beginBlock ( msg );
+  typedef typename KSpace::Space Space;
+  typedef typename Space::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector < Domain, BIG_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type DigitalSet;
+  typedef DigitalSetBoundary<KSpace,DigitalSet> DSContainer;
+  typedef DigitalSurface<DSContainer> MyDS;
+  typedef IndexedDigitalSurface<DSContainer> MyIDS;
+  typedef typename MyIDS::Index Index;
+  typedef typename MyIDS::Surfel Surfel;
+  typedef typename MyIDS::Arc Arc;
+  typedef typename MyIDS::Face Face;
+
+  BOOST_CONCEPT_ASSERT(( CConstSinglePassRange < MyIDS> ));
+  BOOST_CONCEPT_ASSERT(( CUndirectedSimpleLocalGraph < MyIDS> ));
+  BOOST_CONCEPT_ASSERT(( CUndirectedSimpleGraph < MyIDS> ));
+
+  Point p0 = Point::diagonal( 0 );
+  Point p1 = Point::diagonal( -6 );
+  Point p2 = Point::diagonal( 6 );
+  Domain domain( p1, p2 );
+  DigitalSet dig_set( domain );
+  Shapes<Domain>::addNorm2Ball( dig_set, p0, 3 );
+  Shapes<Domain>::removeNorm2Ball( dig_set, p0, 1 );
+  KSpace K;
+  nbok += K.init( domain.lowerBound(), domain.upperBound(), true ) ? 1 : 0;
+  nb++;
+
+  MyDS digsurf( new DSContainer( K, dig_set ) );
+  MyIDS idxsurf( digsurf );
+  trace.info() << idxsurf << std::endl;
+  nb++, nbok += idxsurf.isValid() ? 1 : 0;
+  nb++, nbok += idxsurf.size() == digsurf.size() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "idxsurf.size() = " << idxsurf.size()
+               << " == " << digsurf.size() << std::endl;
+
+  // Vertices and neighbors.
+  unsigned int nbVtxOk = 0;
+  Index i = 0;
+  for ( typename MyDS::ConstIterator it = digsurf.begin(), it_end = digsurf.end();
+        it != it_end; ++it, ++i )
+    {
+      std::vector<Surfel> n1, n2;
+      std::back_insert_iterator< std::vector<Surfel> > o1 = std::back_inserter( n1 );
+      std::back_insert_iterator< std::vector<Surfel> > o2 = std::back_inserter( n2 );
+      digsurf.writeNeighbors( o1, *it );
+      idxsurf.writeNeighbors( o2, *it );
+      bool ok = ( idxsurf.index( *it ) == i ) && ( idxsurf.vertex( i ) == *it )
+        && ( idxsurf.degree( *it ) == digsurf.degree( *it ) )
+        && ( n1 == n2 );
+      nbVtxOk += ok ? 1 : 0;
+    }
+  nb++, nbok += nbVtxOk == digsurf.size() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vertices and neighbors ok = " << nbVtxOk << std::endl;
+
+  // Arcs.
+  unsigned int nbArcsOk = 0;
+  unsigned int nbArcs = 0;
+  for ( Index v = 0; v < idxsurf.size(); ++v )
+    {
+      typename MyDS::ArcRange arcs = digsurf.outArcs( idxsurf.vertex( v ) );
+      nbArcs += arcs.size();
+      Index a = idxsurf.arcsBegin( v );
+      for ( typename MyDS::ArcRange::const_iterator it = arcs.begin(), it_end = arcs.end();
+            it != it_end; ++it, ++a )
+        {
+          Arc opp = digsurf.opposite( *it );
+          bool ok = ( a < idxsurf.arcsEnd( v ) ) && ( idxsurf.arc( a ) == *it )
+            && ( idxsurf.index( *it ) == a )
+            && ( idxsurf.tail( a ) == v )
+            && ( idxsurf.vertex( idxsurf.head( a ) ) == digsurf.head( *it ) )
+            && ( idxsurf.arc( idxsurf.opposite( a ) ) == opp );
+          nbArcsOk += ok ? 1 : 0;
+        }
+    }
+  nb++, nbok += ( nbArcsOk == nbArcs ) && ( idxsurf.nbArcs() == nbArcs ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "arcs ok = " << nbArcsOk << " / " << nbArcs << std::endl;
+
+  // Faces.
+  if ( KSpace::dimension >= 3 )
+    {
+      typename MyDS::FaceSet faces = digsurf.allFaces();
+      unsigned int nbFacesOk = 0;
+      Index f = 0;
+      for ( typename MyDS::FaceSet::const_iterator it = faces.begin(), it_end = faces.end();
+            it != it_end; ++it, ++f )
+        {
+          Face face = idxsurf.face( f );
+          typename MyDS::VertexRange vtcs = digsurf.verticesAroundFace( *it );
+          std::vector<Surfel> idxVtcs;
+          for ( typename MyIDS::IndexConstIterator itv = idxsurf.verticesAroundFaceBegin( f ),
+                  itv_end = idxsurf.verticesAroundFaceEnd( f ); itv != itv_end; ++itv )
+            idxVtcs.push_back( idxsurf.vertex( *itv ) );
+          bool ok = ( face == *it ) && ( face.nbVertices == it->nbVertices )
+            && ( idxsurf.isClosed( f ) == it->isClosed() )
+            && ( vtcs == idxVtcs );
+          nbFacesOk += ok ? 1 : 0;
+        }
+      nb++, nbok += ( nbFacesOk == faces.size() ) && ( idxsurf.nbFaces() == faces.size() ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "faces ok = " << nbFacesOk << " / " << faces.size() << std::endl;
+
+      unsigned int nbVtxFacesOk = 0;
+      for ( Index v = 0; v < idxsurf.size(); ++v )
+        {
+          typename MyDS::FaceRange faces1 = digsurf.facesAroundVertex( idxsurf.vertex( v ) );
+          typename MyIDS::IndexRange faces2 = idxsurf.facesAroundVertex( v );
+          bool ok = faces1.size() == faces2.size();
+          for ( unsigned int j = 0; ok && ( j < faces1.size() ); ++j )
+            ok = idxsurf.face( faces2[ j ] ) == faces1[ j ];
+          nbVtxFacesOk += ok ? 1 : 0;
+        }
+      nb++, nbok += nbVtxFacesOk == idxsurf.size() ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "faces around vertices ok = " << nbVtxFacesOk << std::endl;
+    }
+  else
+    {
+      nb++, nbok += idxsurf.nbFaces() == 0 ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "no faces in 2D" << std::endl;
+    }
+
+  // Indexed properties.
+  typename MyIDS::template IndexedProperty<double>::Type area
+    = idxsurf.makeVertexProperty( 1.0 );
+  typename MyIDS::template IndexedProperty<unsigned int>::Type marks
+    = idxsurf.makeArcProperty( 0u );
+  nb++, nbok += ( area.size() == idxsurf.size() )
+    && ( marks.size() == idxsurf.nbArcs() )
+    && ( idxsurf.makeFaceProperty( 0 ).size() == idxsurf.nbFaces() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "indexed properties" << std::endl;
+
+  // Copy.
+  MyIDS copy( idxsurf );
+  nb++, nbok += ( copy.size() == idxsurf.size() )
+    && ( copy.nbArcs() == idxsurf.nbArcs() )
+    && ( copy.nbFaces() == idxsurf.nbFaces() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "copy" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class IndexedDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testIndexedDigitalSurface<KhalimskySpaceND<2> >()
+    && testIndexedDigitalSurface<KhalimskySpaceND<3> >()
+    && testIndexedDigitalSurface<KhalimskySpaceND<3, DGtal::int32_t, KhalimskyHashContainers> >()
+    && testIndexedDigitalSurface<KhalimskySpaceND<4> >();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
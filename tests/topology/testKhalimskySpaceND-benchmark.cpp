@@ -0,0 +1,147 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskySpaceND-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Boundary tracking and surface traversal of a 3D ball given by an
+ * implicit predicate, with the ordered cell containers of
+ * KhalimskySpaceND (KhalimskyOrderedContainers) versus its hashed
+ * cell containers (KhalimskyHashContainers).
+ *
+ * Usage: testKhalimskySpaceND-benchmark [radius]
+ * (default: 100).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the cell containers of class KhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Euclidean ball centered at the origin.
+ */
+struct BallPredicate
+{
+  typedef Z3i::Point Point;
+
+  BallPredicate( const double aRadius )
+    : mySquaredRadius( aRadius * aRadius )
+  {}
+
+  bool operator()( const Point & p ) const
+  {
+    return (double)p[ 0 ] * p[ 0 ] + (double)p[ 1 ] * p[ 1 ]
+      + (double)p[ 2 ] * p[ 2 ] <= mySquaredRadius;
+  }
+
+  double mySquaredRadius;
+};
+
+/**
+ * Tracks the boundary of the ball and traverses it with a
+ * LightImplicitDigitalSurface, with the cell containers of the space
+ * KSpace.
+ *
+ * @param radius the radius of the ball.
+ * @param nbTracked (returns) the number of surfels of the tracked boundary.
+ * @param nbVisited (returns) the number of surfels of the traversal.
+ */
+template <typename KSpace>
+void benchmarkCellContainers( const int radius,
+                              unsigned int & nbTracked,
+                              unsigned int & nbVisited )
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::SurfelSet SurfelSet;
+  typedef LightImplicitDigitalSurface<KSpace, BallPredicate> Boundary;
+  typedef typename Boundary::SurfelConstIterator ConstIterator;
+
+  BallPredicate ball( radius );
+  KSpace K;
+  K.init( Z3i::Point::diagonal( -radius - 2 ), Z3i::Point::diagonal( radius + 2 ), true );
+  SurfelAdjacency<3> adjacency( true );
+  const SCell start = Surfaces<KSpace>::findABel( K, ball, Z3i::Point::diagonal( 0 ),
+                                                  Z3i::Point::diagonal( radius + 1 ) );
+
+  SurfelSet boundary;
+  trace.beginBlock( "trackBoundary" );
+  Surfaces<KSpace>::trackBoundary( boundary, K, adjacency, ball, start );
+  trace.endBlock();
+  nbTracked = (unsigned int) boundary.size();
+
+  trace.beginBlock( "LightImplicitDigitalSurface traversal" );
+  Boundary surface( K, ball, adjacency, start );
+  nbVisited = 0;
+  for ( ConstIterator it = surface.begin(), itEnd = surface.end(); it != itEnd; ++it )
+    ++nbVisited;
+  trace.endBlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef KhalimskySpaceND< 3, Z3i::Integer, KhalimskyOrderedContainers > OrderedKSpace;
+  typedef KhalimskySpaceND< 3, Z3i::Integer, KhalimskyHashContainers > HashKSpace;
+
+  trace.beginBlock ( "Benchmarking the cell containers of class KhalimskySpaceND" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int radius = ( argc > 1 ) ? atoi( argv[1] ) : 100;
+  unsigned int nbTracked[ 2 ];
+  unsigned int nbVisited[ 2 ];
+
+  trace.beginBlock( "Ordered containers (std::set, std::map)" );
+  benchmarkCellContainers<OrderedKSpace>( radius, nbTracked[ 0 ], nbVisited[ 0 ] );
+  trace.endBlock();
+
+  trace.beginBlock( "Hashed containers (boost::unordered_set, boost::unordered_map)" );
+  benchmarkCellContainers<HashKSpace>( radius, nbTracked[ 1 ], nbVisited[ 1 ] );
+  trace.endBlock();
+
+  trace.info() << nbTracked[ 0 ] << " surfels" << std::endl;
+  const bool res = ( nbTracked[ 0 ] == nbTracked[ 1 ] )
+    && ( nbVisited[ 0 ] == nbVisited[ 1 ] )
+    && ( nbTracked[ 0 ] == nbVisited[ 0 ] );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
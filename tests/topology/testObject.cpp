@@ -346,6 +346,105 @@ bool testObject3D()
 
 }
 
+/**
+ * @return 'true' if the border of an object whose points are stored
+ * in a DigitalSetByBitVector (computed word by word) is the border
+ * of the same object stored in a DigitalSetBySTLSet.
+ */
+template <typename DigitalTopology, typename Domain, typename Predicate>
+bool sameBorders( const DigitalTopology & dt, const Domain & domain,
+                  const Predicate & shape )
+{
+  typedef DigitalSetByBitVector<Domain> BitSet;
+  typedef DigitalSetBySTLSet<Domain> STLSet;
+  BitSet bitSet( domain );
+  STLSet stlSet( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( shape( *it ) )
+      {
+        bitSet.insertNew( *it );
+        stlSet.insertNew( *it );
+      }
+  Object<DigitalTopology, BitSet> bitObject( dt, bitSet );
+  Object<DigitalTopology, STLSet> stlObject( dt, stlSet );
+  const Object<DigitalTopology, BitSet> bitObjectBorder = bitObject.border();
+  const Object<DigitalTopology, STLSet> stlObjectBorder = stlObject.border();
+  const BitSet & bitBorder = bitObjectBorder.pointSet();
+  const STLSet & stlBorder = stlObjectBorder.pointSet();
+  bool ok = bitBorder.isValid() && ( bitBorder.size() == stlBorder.size() );
+  for ( typename STLSet::ConstIterator it = stlBorder.begin(), itEnd = stlBorder.end();
+        it != itEnd; ++it )
+    ok = ok && bitBorder( *it );
+  trace.info() << "border of " << bitSet.size() << " points: "
+               << bitBorder.size() << " points" << std::endl;
+  return ok;
+}
+
+/**
+ * Ball shape, which may cross the domain bounds.
+ */
+template <typename Point>
+struct BallShape
+{
+  BallShape( const Point & c, double r ) : center( c ), radius( r ) {}
+  bool operator()( const Point & p ) const
+  {
+    return ( p - center ).norm() <= radius;
+  }
+  Point center;
+  double radius;
+};
+
+/**
+ * Border of objects stored in a DigitalSetByBitVector (word by word)
+ * and in a DigitalSetBySTLSet (point by point).
+ */
+bool testBitVectorBorder()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing the border of bit vector sets ..." );
+  typedef SpaceND< 3 > Z3;
+  typedef HyperRectDomain< Z3 > Domain3;
+  typedef Z3::Point Point3;
+  typedef MetricAdjacency< Z3, 1 > Adj6;
+  typedef MetricAdjacency< Z3, 2 > Adj18;
+  typedef MetricAdjacency< Z3, 3 > Adj26;
+  Adj6 adj6;
+  Adj18 adj18;
+  Adj26 adj26;
+  DigitalTopology< Adj6, Adj18 > dt6_18( adj6, adj18, JORDAN_DT );
+  DigitalTopology< Adj26, Adj6 > dt26_6( adj26, adj6, JORDAN_DT );
+  // Rows of 37 bits, not aligned on words; the ball crosses the
+  // domain bounds.
+  const Domain3 domain3( Point3( -10, -5, -3 ), Point3( 26, 17, 7 ) );
+  const BallShape<Point3> ball3( Point3( 8, 6, 2 ), 9.5 );
+  INBLOCK_TEST2( sameBorders( dt6_18, domain3, ball3 ), "(6,18) border of a 3D ball" );
+  INBLOCK_TEST2( sameBorders( dt26_6, domain3, ball3 ), "(26,6) border of a 3D ball" );
+
+  typedef SpaceND< 2 > Z2;
+  typedef HyperRectDomain< Z2 > Domain2;
+  typedef Z2::Point Point2;
+  typedef MetricAdjacency< Z2, 1 > Adj4;
+  typedef MetricAdjacency< Z2, 2 > Adj8;
+  typedef DomainAdjacency< Domain2, Adj4 > DomainAdj4;
+  typedef DomainAdjacency< Domain2, Adj8 > DomainAdj8;
+  // Rows of 130 bits.
+  const Domain2 domain2( Point2( 0, 0 ), Point2( 129, 40 ) );
+  Adj4 adj4;
+  Adj8 adj8;
+  DomainAdj4 dadj4( domain2, adj4 );
+  DomainAdj8 dadj8( domain2, adj8 );
+  DigitalTopology< DomainAdj4, DomainAdj8 > dt4_8( dadj4, dadj8, JORDAN_DT );
+  const BallShape<Point2> ball2( Point2( 100, 20 ), 35.0 );
+  INBLOCK_TEST2( sameBorders( dt4_8, domain2, ball2 ), "(4,8) border of a 2D ball" );
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 /**
  * Example of a test. To be completed.
  *
@@ -669,7 +768,7 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testObject() && 
-    testObject3D() && testDraw()
+    testObject3D() && testBitVectorBorder() && testDraw()
     && testSimplePoints3D()
     && testSimplePoints2D();
 
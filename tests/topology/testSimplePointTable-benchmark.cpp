@@ -0,0 +1,118 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplePointTable-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Simple point tests on all the points of a random 3D volume:
+ * Object::isSimple versus SimplePointTable (bitwise evaluation and
+ * precomputed table).
+ *
+ * Usage: testSimplePointTable-benchmark [size] [density]
+ * (default: 32^3 volume, 50% of object points).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SimplePointTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class SimplePointTable.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TObject>
+bool runABenchmark( const std::string & aName,
+                    const typename TObject::DigitalTopology & aTopology,
+                    const Z3i::DigitalSet & aSet )
+{
+  typedef SimplePointTable<typename TObject::DigitalTopology> Table;
+  trace.beginBlock( aName );
+  TObject object( aTopology, aSet );
+  unsigned int nbSimple = 0;
+  unsigned int nbSimpleTable = 0;
+  unsigned int nbSimplePrecomputed = 0;
+
+  trace.beginBlock( "Object::isSimple" );
+  for ( Z3i::DigitalSet::ConstIterator it = aSet.begin(), itEnd = aSet.end(); it != itEnd; ++it )
+    nbSimple += object.isSimple( *it ) ? 1 : 0;
+  double t = trace.endBlock();
+  trace.info() << 1000.0 * t / aSet.size() << " us per query" << std::endl;
+
+  Table table( aTopology );
+  trace.beginBlock( "SimplePointTable (bitwise)" );
+  for ( Z3i::DigitalSet::ConstIterator it = aSet.begin(), itEnd = aSet.end(); it != itEnd; ++it )
+    nbSimpleTable += object.isSimple( *it, table ) ? 1 : 0;
+  t = trace.endBlock();
+  trace.info() << 1000.0 * t / aSet.size() << " us per query" << std::endl;
+
+  trace.beginBlock( "SimplePointTable::precompute" );
+  table.precompute();
+  trace.endBlock();
+
+  trace.beginBlock( "SimplePointTable (precomputed)" );
+  for ( Z3i::DigitalSet::ConstIterator it = aSet.begin(), itEnd = aSet.end(); it != itEnd; ++it )
+    nbSimplePrecomputed += object.isSimple( *it, table ) ? 1 : 0;
+  t = trace.endBlock();
+  trace.info() << 1000.0 * t / aSet.size() << " us per query" << std::endl;
+
+  trace.info() << nbSimple << " simple points, " << table << std::endl;
+  trace.endBlock();
+  return ( nbSimple == nbSimpleTable ) && ( nbSimple == nbSimplePrecomputed );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking class SimplePointTable" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[1] ) : 32;
+  const int density = ( argc > 2 ) ? atoi( argv[2] ) : 50;
+
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Z3i::DigitalSet set( domain );
+  srand( 0 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( rand() % 100 < density )
+      set.insertNew( *it );
+  trace.info() << set.size() << " points in " << domain << std::endl;
+
+  bool res = runABenchmark<Z3i::Object6_26>( "6-26 topology", Z3i::dt6_26, set )
+    && runABenchmark<Z3i::Object26_6>( "26-6 topology", Z3i::dt26_6, set );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,139 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSimplePointTable.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class SimplePointTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SimplePointTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST2(x,y) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << y << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SimplePointTable.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares SimplePointTable::isSimple with Object::isSimple on
+ * configurations of the 3^n neighborhood of the origin: all of them
+ * if @a aNbConfigurations is 0, @a aNbConfigurations random ones
+ * otherwise.
+ */
+template <typename TObject>
+bool testTable( const std::string & aName,
+                const typename TObject::DigitalTopology & aTopology,
+                const unsigned int aNbConfigurations )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef TObject ObjectType;
+  typedef typename ObjectType::DigitalTopology DigitalTopology;
+  typedef typename ObjectType::Domain Domain;
+  typedef typename ObjectType::DigitalSet DigitalSet;
+  typedef typename ObjectType::Point Point;
+  typedef SimplePointTable<DigitalTopology> Table;
+  typedef typename Table::Configuration Configuration;
+
+  trace.beginBlock ( "Simple points: " + aName );
+  Table table( aTopology );
+  Table bitwiseTable( aTopology, false );
+  trace.info() << table << std::endl;
+  INBLOCK_TEST2( table.isValid() && ! bitwiseTable.isPrecomputed()
+                 && ( table.isPrecomputed() == ( Domain::Space::dimension == 2 ) )
+                 && ( table.size() + 1 == ( Domain::Space::dimension == 2 ? 9u : 27u ) ),
+                 "Neighborhood of " << table.size() << " points" );
+
+  const Point origin = Point::diagonal( 0 );
+  const Domain domain( Point::diagonal( -1 ), Point::diagonal( 1 ) );
+  const Configuration nbAll = (Configuration)1 << table.size();
+  const unsigned int n = ( aNbConfigurations == 0 ) ? nbAll : aNbConfigurations;
+  unsigned int nbSimple = 0;
+  bool ok = true;
+  bool okConfiguration = true;
+  for ( unsigned int k = 0; ok && ( k < n ); ++k )
+    {
+      const Configuration c = ( aNbConfigurations == 0 ) ? (Configuration)k
+        : (Configuration)( ( ( (DGtal::uint64_t)rand() << 16 ) ^ rand() ) % nbAll );
+      DigitalSet set( domain );
+      set.insertNew( origin );
+      for ( unsigned int i = 0; i < table.size(); ++i )
+        if ( c & ( (Configuration)1 << i ) )
+          set.insertNew( table.offset( i ) );
+      ObjectType object( aTopology, set );
+      okConfiguration = okConfiguration
+        && ( table.configuration( object.pointSet(), origin ) == c );
+
+      const bool expected = object.isSimple( origin );
+      nbSimple += expected ? 1 : 0;
+      ok = ( table.isSimple( c ) == expected )
+        && ( bitwiseTable.isSimple( c ) == expected )
+        && ( object.isSimple( origin, table ) == expected );
+      if ( ! ok )
+        trace.error() << "Configuration " << c << ": expected " << expected << std::endl;
+    }
+  INBLOCK_TEST2( okConfiguration, "Configurations" );
+  INBLOCK_TEST2( ok, "Same answers as Object::isSimple on " << n
+                 << " configurations (" << nbSimple << " simple)" );
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SimplePointTable" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = testTable<Z2i::Object4_8>( "4-8", Z2i::dt4_8, 0 )
+    && testTable<Z2i::Object8_4>( "8-4", Z2i::dt8_4, 0 )
+    && testTable<Z3i::Object6_18>( "6-18", Z3i::dt6_18, 1000 )
+    && testTable<Z3i::Object18_6>( "18-6", Z3i::dt18_6, 1000 )
+    && testTable<Z3i::Object6_26>( "6-26", Z3i::dt6_26, 1000 )
+    && testTable<Z3i::Object26_6>( "26-6", Z3i::dt26_6, 1000 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
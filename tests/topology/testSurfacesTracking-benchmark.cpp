@@ -0,0 +1,121 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfacesTracking-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Boundary tracking of a 3D ball given by an implicit predicate:
+ * Surfaces::trackBoundary and Surfaces::trackClosedBoundary versus
+ * their parallel versions.
+ *
+ * Usage: testSurfacesTracking-benchmark [radius]
+ * (default: 100).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the tracking of class Surfaces.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Euclidean ball centered at the origin.
+ */
+struct BallPredicate
+{
+  typedef Z3i::Point Point;
+
+  BallPredicate( const double aRadius )
+    : mySquaredRadius( aRadius * aRadius )
+  {}
+
+  bool operator()( const Point & p ) const
+  {
+    return (double)p[ 0 ] * p[ 0 ] + (double)p[ 1 ] * p[ 1 ]
+      + (double)p[ 2 ] * p[ 2 ] <= mySquaredRadius;
+  }
+
+  double mySquaredRadius;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef Z3i::KSpace KSpace;
+  typedef KSpace::SCell SCell;
+
+  trace.beginBlock ( "Benchmarking the tracking of class Surfaces" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int radius = ( argc > 1 ) ? atoi( argv[1] ) : 100;
+  BallPredicate ball( radius );
+  KSpace K;
+  K.init( Z3i::Point::diagonal( -radius - 2 ), Z3i::Point::diagonal( radius + 2 ), true );
+  SurfelAdjacency<3> adjacency( true );
+  const SCell start = Surfaces<KSpace>::findABel( K, ball, Z3i::Point::diagonal( 0 ),
+                                                  Z3i::Point::diagonal( radius + 1 ) );
+
+  std::set<SCell> boundary;
+  trace.beginBlock( "trackBoundary" );
+  Surfaces<KSpace>::trackBoundary( boundary, K, adjacency, ball, start );
+  trace.endBlock();
+
+  std::set<SCell> parallelBoundary;
+  trace.beginBlock( "parallelTrackBoundary" );
+  Surfaces<KSpace>::parallelTrackBoundary( parallelBoundary, K, adjacency, ball, start );
+  trace.endBlock();
+
+  std::set<SCell> closedBoundary;
+  trace.beginBlock( "trackClosedBoundary" );
+  Surfaces<KSpace>::trackClosedBoundary( closedBoundary, K, adjacency, ball, start );
+  trace.endBlock();
+
+  std::set<SCell> parallelClosedBoundary;
+  trace.beginBlock( "parallelTrackClosedBoundary" );
+  Surfaces<KSpace>::parallelTrackClosedBoundary( parallelClosedBoundary, K, adjacency,
+                                                 ball, start );
+  trace.endBlock();
+
+  trace.info() << boundary.size() << " surfels" << std::endl;
+  const bool res = ( boundary == parallelBoundary )
+    && ( closedBoundary == parallelClosedBoundary );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
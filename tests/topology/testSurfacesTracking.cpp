@@ -0,0 +1,130 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfacesTracking.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the parallel boundary tracking of class
+ * Surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+#define INBLOCK_TEST2(x,y) \
+  nbok += ( x ) ? 1 : 0; \
+  nb++; \
+  trace.info() << "(" << nbok << "/" << nb << ") " \
+  << y << std::endl;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Surfaces.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Tracks the boundary of a ball with random holes, with the
+ * sequential and parallel trackers and both surfel adjacencies.
+ */
+template <typename KSpace>
+bool testParallelTracking( const std::string & aName,
+                           const int aRadius, const int aDensity )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+
+  trace.beginBlock ( "Parallel tracking: " + aName );
+  const Point low = Point::diagonal( -aRadius - 2 );
+  const Point high = Point::diagonal( aRadius + 2 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape( domain );
+  for ( typename Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    if ( ( (*it).norm() <= aRadius ) && ( rand() % 100 >= aDensity ) )
+      shape.insertNew( *it );
+  shape.insert( Point::diagonal( 0 ) );
+  const SCell start = Surfaces<KSpace>::findABel( K, shape, Point::diagonal( 0 ), high );
+
+  for ( unsigned int i = 0; i < 2; ++i )
+    {
+      SurfelAdjacency<KSpace::dimension> adjacency( i == 0 );
+      std::set<SCell> boundary;
+      std::set<SCell> parallelBoundary;
+      Surfaces<KSpace>::trackBoundary( boundary, K, adjacency, shape, start );
+      Surfaces<KSpace>::parallelTrackBoundary( parallelBoundary, K, adjacency, shape, start );
+      INBLOCK_TEST2( ( boundary.size() > 1 ) && ( boundary == parallelBoundary ),
+                     "trackBoundary (" << ( i == 0 ? "interior" : "exterior" ) << "): "
+                     << boundary.size() << " surfels" );
+
+      std::set<SCell> closedBoundary;
+      std::set<SCell> parallelClosedBoundary;
+      Surfaces<KSpace>::trackClosedBoundary( closedBoundary, K, adjacency, shape, start );
+      Surfaces<KSpace>::parallelTrackClosedBoundary( parallelClosedBoundary, K, adjacency,
+                                                     shape, start );
+      INBLOCK_TEST2( ( closedBoundary == parallelClosedBoundary ),
+                     "trackClosedBoundary (" << ( i == 0 ? "interior" : "exterior" ) << "): "
+                     << closedBoundary.size() << " surfels" );
+    }
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing parallel tracking of class Surfaces" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = testParallelTracking< KhalimskySpaceND<2> >( "2D", 40, 5 )
+    && testParallelTracking< KhalimskySpaceND<3> >( "3D", 16, 10 )
+    && testParallelTracking< KhalimskySpaceND<4> >( "4D", 5, 10 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////